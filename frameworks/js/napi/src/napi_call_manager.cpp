@@ -2477,11 +2477,14 @@ void NapiCallManager::NativeStartDTMF(napi_env env, void *data)
         return;
     }
     auto asyncContext = (AsyncContext *)data;
-    if (asyncContext->numberLen < TWO_VALUE_LIMIT) {
+    if (asyncContext->numberLen == ONLY_ONE_VALUE) {
         asyncContext->result = DelayedSingleton<CallManagerClient>::GetInstance()->StartDtmf(
             asyncContext->callId, asyncContext->number[ARRAY_INDEX_FIRST]);
     } else {
-        asyncContext->result = CALL_ERR_DTMF_EXCEED_LIMIT;
+        // a whole string is played by the service, an empty one continues a string held by a wait character
+        std::u16string dtmfString = Str8ToStr16(std::string(asyncContext->number, asyncContext->numberLen));
+        asyncContext->result = DelayedSingleton<CallManagerClient>::GetInstance()->SendDtmfString(
+            asyncContext->callId, dtmfString, 0, 0);
     }
 }
 
@@ -45,6 +45,10 @@ public:
     int32_t AnswerCall(int32_t callId, int32_t videoState);
     int32_t RejectCall(int32_t callId, bool isSendSms, std::u16string content);
     int32_t HangUpCall(int32_t callId);
+    int32_t AnswerAndHoldActiveCall(int32_t callId, int32_t videoState);
+    int32_t AnswerAndEndActiveCall(int32_t callId, int32_t videoState);
+    int32_t HangUpAllCall();
+    int32_t HangUpAllCallOnSlot(int32_t slotId);
     int32_t GetCallState();
     int32_t HoldCall(int32_t callId);
     int32_t UnHoldCall(int32_t callId);
@@ -54,6 +58,7 @@ public:
     int32_t GetMainCallId(int32_t &callId);
     std::vector<std::u16string> GetSubCallIdList(int32_t callId);
     std::vector<std::u16string> GetCallIdListForConference(int32_t callId);
+    int32_t GetCallSnapshot(std::vector<CallSnapshotInfo> &callList);
     int32_t GetCallWaiting(int32_t slotId);
     int32_t SetCallWaiting(int32_t slotId, bool activate);
     int32_t GetCallRestriction(int32_t slotId, CallRestrictionType type);
@@ -63,6 +68,7 @@ public:
     int32_t SetCallPreferenceMode(int32_t slotId, int32_t mode);
     int32_t StartDtmf(int32_t callId, char str);
     int32_t StopDtmf(int32_t callId);
+    int32_t SendDtmfString(int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength);
     bool IsRinging();
     bool HasCall();
     bool IsNewCallAllowed();
@@ -98,6 +98,43 @@ public:
      */
     int32_t HangUpCall(int32_t callId) override;
 
+    /**
+     * AnswerAndHoldActiveCall
+     *
+     * @brief Hold the active call and answer the incoming call in one request
+     * @param callId[in], call id of the incoming call
+     * @param videoState[in], 0: audio, 1: video
+     * @return Returns 0 on success, others on failure.
+     */
+    int32_t AnswerAndHoldActiveCall(int32_t callId, int32_t videoState) override;
+
+    /**
+     * AnswerAndEndActiveCall
+     *
+     * @brief Hang up the active call and answer the incoming call in one request
+     * @param callId[in], call id of the incoming call
+     * @param videoState[in], 0: audio, 1: video
+     * @return Returns 0 on success, others on failure.
+     */
+    int32_t AnswerAndEndActiveCall(int32_t callId, int32_t videoState) override;
+
+    /**
+     * HangUpAllCall
+     *
+     * @brief Hang up all the calls in one request
+     * @return Returns 0 on success, others on failure.
+     */
+    int32_t HangUpAllCall() override;
+
+    /**
+     * HangUpAllCallOnSlot
+     *
+     * @brief Hang up all the calls of one SIM card in one request
+     * @param slotId[in], The slot id
+     * @return Returns 0 on success, others on failure.
+     */
+    int32_t HangUpAllCallOnSlot(int32_t slotId) override;
+
     /**
      * GetCallState
      *
@@ -210,6 +247,20 @@ public:
      */
     int32_t StopDtmf(int32_t callId) override;
 
+    /**
+     * SendDtmfString
+     *
+     * @brief Send a string of DTMF, the digits are played one after another by the call manager.
+     * P, p or ',' pauses for DTMF_PAUSE_LENGTH, W, w or ';' holds the following digits until
+     * the string is continued by an empty one.
+     * @param callId[in], call id
+     * @param dtmfString[in], Characters sent
+     * @param onLength[in], Length of every tone in ms, 0 selects DTMF_DEFAULT_ON_LENGTH
+     * @param offLength[in], Length of the gap after every tone in ms, 0 selects DTMF_DEFAULT_OFF_LENGTH
+     * @return Returns 0 on success, others on failure.
+     */
+    int32_t SendDtmfString(int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength) override;
+
     /**
      * GetCallWaiting
      *
@@ -425,6 +476,16 @@ public:
      */
     std::vector<std::u16string> GetCallIdListForConference(int32_t callId) override;
 
+    /**
+     * GetCallSnapshot
+     *
+     * @brief Obtain the attributes and the conference topology of all calls in one request
+     * @param callList[out], The call list, in the order the calls were created
+     * @return Returns 0 on success, TELEPHONY_ERR_PERMISSION_ERR without the SET_TELEPHONY_STATE permission,
+     * others on failure.
+     */
+    int32_t GetCallSnapshot(std::vector<CallSnapshotInfo> &callList) override;
+
     /**
      * GetImsConfig
      *
@@ -577,6 +638,11 @@ public:
     sptr<IRemoteObject> GetProxyObjectPtr(CallManagerProxyType proxyType) override;
 
 private:
+    int32_t ReadCallSnapshotEntries(
+        MessageParcel &replyParcel, uint32_t entrySize, uint32_t entryNum, std::vector<CallSnapshotInfo> &callList);
+    int32_t CopyCallSnapshotEntries(
+        const void *data, uint32_t entrySize, uint32_t entryNum, std::vector<CallSnapshotInfo> &callList);
+
     static inline BrokerDelegator<CallManagerServiceProxy> delegator_;
 };
 } // namespace Telephony
@@ -87,13 +87,33 @@ enum CallManagerSurfaceCode {
     INTERFACE_REPORT_OTT_CALL_DETAIL_INFO,
     INTERFACE_REPORT_OTT_CALL_EVENT_INFO,
     INTERFACE_GET_PROXY_OBJECT_PTR,
+    INTERFACE_ANSWER_AND_HOLD_ACTIVE_CALL,
+    INTERFACE_ANSWER_AND_END_ACTIVE_CALL,
+    INTERFACE_HANG_UP_ALL_CALL,
+    INTERFACE_HANG_UP_ALL_CALL_ON_SLOT,
+    INTERFACE_GET_CALL_SNAPSHOT,
+    INTERFACE_SEND_DTMF_STRING,
 };
 
 enum CallManagerProxyType {
     PROXY_BLUETOOTH_CALL = 0,
 };
+
+enum CallSnapshotTransport {
+    CALL_SNAPSHOT_TRANSPORT_PARCEL = 0,
+    CALL_SNAPSHOT_TRANSPORT_ASHMEM,
+};
 } // end extern
 
+/**
+ * call snapshot reply: result, version, entry size, entry number, transport, then the entries,
+ * either copied into the parcel or in an ashmem region. A newer version only appends fields
+ * to CallSnapshotInfo, so the reader copies min(entry size, sizeof(CallSnapshotInfo)) per entry.
+ */
+constexpr uint32_t CALL_SNAPSHOT_VERSION = 1;
+// entries larger than this in total are passed through ashmem instead of being copied into the parcel
+constexpr int32_t CALL_SNAPSHOT_ASHMEM_THRESHOLD = 16 * 1024;
+
 class ICallManagerService : public IRemoteBroker {
 public:
     virtual ~ICallManagerService() = default;
@@ -103,6 +123,10 @@ public:
     virtual int32_t AnswerCall(int32_t callId, int32_t videoState) = 0;
     virtual int32_t RejectCall(int32_t callId, bool rejectWithMessage, std::u16string textMessage) = 0;
     virtual int32_t HangUpCall(int32_t callId) = 0;
+    virtual int32_t AnswerAndHoldActiveCall(int32_t callId, int32_t videoState) = 0;
+    virtual int32_t AnswerAndEndActiveCall(int32_t callId, int32_t videoState) = 0;
+    virtual int32_t HangUpAllCall() = 0;
+    virtual int32_t HangUpAllCallOnSlot(int32_t slotId) = 0;
     virtual int32_t GetCallState() = 0;
     virtual int32_t HoldCall(int32_t callId) = 0;
     virtual int32_t UnHoldCall(int32_t callId) = 0;
@@ -116,6 +140,7 @@ public:
     virtual bool IsInEmergencyCall() = 0;
     virtual int32_t StartDtmf(int32_t callId, char str) = 0;
     virtual int32_t StopDtmf(int32_t callId) = 0;
+    virtual int32_t SendDtmfString(int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength) = 0;
     virtual int32_t GetCallWaiting(int32_t slotId) = 0;
     virtual int32_t SetCallWaiting(int32_t slotId, bool activate) = 0;
     virtual int32_t GetCallRestriction(int32_t slotId, CallRestrictionType type) = 0;
@@ -132,6 +157,7 @@ public:
     virtual int32_t GetMainCallId(int32_t callId) = 0;
     virtual std::vector<std::u16string> GetSubCallIdList(int32_t callId) = 0;
     virtual std::vector<std::u16string> GetCallIdListForConference(int32_t callId) = 0;
+    virtual int32_t GetCallSnapshot(std::vector<CallSnapshotInfo> &callList) = 0;
     virtual int32_t ControlCamera(std::u16string cameraId) = 0;
     virtual int32_t SetPreviewWindow(VideoWindow &window) = 0;
     virtual int32_t SetDisplayWindow(VideoWindow &window) = 0;
@@ -135,6 +135,46 @@ int32_t CallManagerClient::HangUpCall(int32_t callId)
     }
 }
 
+int32_t CallManagerClient::AnswerAndHoldActiveCall(int32_t callId, int32_t videoState)
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->AnswerAndHoldActiveCall(callId, videoState);
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
+int32_t CallManagerClient::AnswerAndEndActiveCall(int32_t callId, int32_t videoState)
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->AnswerAndEndActiveCall(callId, videoState);
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
+int32_t CallManagerClient::HangUpAllCall()
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->HangUpAllCall();
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
+int32_t CallManagerClient::HangUpAllCallOnSlot(int32_t slotId)
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->HangUpAllCallOnSlot(slotId);
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
 int32_t CallManagerClient::GetCallState()
 {
     if (g_callManagerProxy != nullptr) {
@@ -229,6 +269,16 @@ std::vector<std::u16string> CallManagerClient::GetCallIdListForConference(int32_
     }
 }
 
+int32_t CallManagerClient::GetCallSnapshot(std::vector<CallSnapshotInfo> &callList)
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->GetCallSnapshot(callList);
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
 int32_t CallManagerClient::GetCallWaiting(int32_t slotId)
 {
     if (g_callManagerProxy != nullptr) {
@@ -319,6 +369,17 @@ int32_t CallManagerClient::StopDtmf(int32_t callId)
     }
 }
 
+int32_t CallManagerClient::SendDtmfString(
+    int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    if (g_callManagerProxy != nullptr) {
+        return g_callManagerProxy->SendDtmfString(callId, dtmfString, onLength, offLength);
+    } else {
+        TELEPHONY_LOGE("init first please!");
+        return TELEPHONY_ERR_UNINIT;
+    }
+}
+
 bool CallManagerClient::IsRinging()
 {
     if (g_callManagerProxy != nullptr) {
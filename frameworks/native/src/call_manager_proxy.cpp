@@ -279,6 +279,66 @@ int32_t CallManagerProxy::HangUpCall(int32_t callId)
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallManagerProxy::AnswerAndHoldActiveCall(int32_t callId, int32_t videoState)
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->AnswerAndHoldActiveCall(callId, videoState);
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerAndHoldActiveCall failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallManagerProxy::AnswerAndEndActiveCall(int32_t callId, int32_t videoState)
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->AnswerAndEndActiveCall(callId, videoState);
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerAndEndActiveCall failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallManagerProxy::HangUpAllCall()
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->HangUpAllCall();
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAllCall failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallManagerProxy::HangUpAllCallOnSlot(int32_t slotId)
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->HangUpAllCallOnSlot(slotId);
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAllCallOnSlot failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallManagerProxy::GetCallState()
 {
     if (ReConnectService() != TELEPHONY_SUCCESS) {
@@ -408,6 +468,21 @@ std::vector<std::u16string> CallManagerProxy::GetCallIdListForConference(int32_t
     return list;
 }
 
+int32_t CallManagerProxy::GetCallSnapshot(std::vector<CallSnapshotInfo> &callList)
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->GetCallSnapshot(callList);
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("GetCallSnapshot failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallManagerProxy::GetCallWaiting(int32_t slotId)
 {
     if (ReConnectService() != TELEPHONY_SUCCESS) {
@@ -543,6 +618,22 @@ int32_t CallManagerProxy::StopDtmf(int32_t callId)
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallManagerProxy::SendDtmfString(
+    int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    if (ReConnectService() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t errCode = callManagerServicePtr_->SendDtmfString(callId, dtmfString, onLength, offLength);
+    if (errCode != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("SendDtmfString failed, errcode:%{public}d", errCode);
+        return errCode;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 bool CallManagerProxy::IsRinging()
 {
     if (ReConnectService() != TELEPHONY_SUCCESS) {
@@ -15,6 +15,10 @@
 
 #include "call_manager_service_proxy.h"
 
+#include <algorithm>
+
+#include <securec.h>
+
 #include "message_option.h"
 #include "message_parcel.h"
 
@@ -161,6 +165,95 @@ int32_t CallManagerServiceProxy::HangUpCall(int32_t callId)
     return replyParcel.ReadInt32();
 }
 
+int32_t CallManagerServiceProxy::AnswerAndHoldActiveCall(int32_t callId, int32_t videoState)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    dataParcel.WriteInt32(callId);
+    dataParcel.WriteInt32(videoState);
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    int32_t error = Remote()->SendRequest(INTERFACE_ANSWER_AND_HOLD_ACTIVE_CALL, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("function AnswerAndHoldActiveCall call failed! errCode:%{public}d", error);
+        return error;
+    }
+    return replyParcel.ReadInt32();
+}
+
+int32_t CallManagerServiceProxy::AnswerAndEndActiveCall(int32_t callId, int32_t videoState)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    dataParcel.WriteInt32(callId);
+    dataParcel.WriteInt32(videoState);
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    int32_t error = Remote()->SendRequest(INTERFACE_ANSWER_AND_END_ACTIVE_CALL, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("function AnswerAndEndActiveCall call failed! errCode:%{public}d", error);
+        return error;
+    }
+    return replyParcel.ReadInt32();
+}
+
+int32_t CallManagerServiceProxy::HangUpAllCall()
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    int32_t error = Remote()->SendRequest(INTERFACE_HANG_UP_ALL_CALL, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("function HangUpAllCall call failed! errCode:%{public}d", error);
+        return error;
+    }
+    return replyParcel.ReadInt32();
+}
+
+int32_t CallManagerServiceProxy::HangUpAllCallOnSlot(int32_t slotId)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    dataParcel.WriteInt32(slotId);
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    int32_t error = Remote()->SendRequest(INTERFACE_HANG_UP_ALL_CALL_ON_SLOT, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("function HangUpAllCallOnSlot call failed! errCode:%{public}d", error);
+        return error;
+    }
+    return replyParcel.ReadInt32();
+}
+
 int32_t CallManagerServiceProxy::GetCallState()
 {
     MessageOption option;
@@ -444,6 +537,33 @@ int32_t CallManagerServiceProxy::StopDtmf(int32_t callId)
     return replyParcel.ReadInt32();
 }
 
+int32_t CallManagerServiceProxy::SendDtmfString(
+    int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    dataParcel.WriteInt32(callId);
+    dataParcel.WriteString16(dtmfString);
+    dataParcel.WriteInt32(onLength);
+    dataParcel.WriteInt32(offLength);
+    int32_t error =
+        Remote()->SendRequest(CallManagerSurfaceCode::INTERFACE_SEND_DTMF_STRING, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("Function SendDtmfString! errCode:%{public}d", error);
+        return error;
+    }
+    return replyParcel.ReadInt32();
+}
+
 int32_t CallManagerServiceProxy::GetCallWaiting(int32_t slotId)
 {
     MessageOption option;
@@ -1000,6 +1120,94 @@ std::vector<std::u16string> CallManagerServiceProxy::GetCallIdListForConference(
     return list;
 }
 
+int32_t CallManagerServiceProxy::GetCallSnapshot(std::vector<CallSnapshotInfo> &callList)
+{
+    callList.clear();
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(CallManagerServiceProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("write descriptor fail");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (Remote() == nullptr) {
+        TELEPHONY_LOGE("function Remote() return nullptr!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    int32_t error = Remote()->SendRequest(INTERFACE_GET_CALL_SNAPSHOT, dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("function GetCallSnapshot call failed! errCode:%{public}d", error);
+        return error;
+    }
+    int32_t result = replyParcel.ReadInt32();
+    if (result != TELEPHONY_SUCCESS) {
+        return result;
+    }
+    uint32_t version = replyParcel.ReadUint32();
+    uint32_t entrySize = replyParcel.ReadUint32();
+    uint32_t entryNum = replyParcel.ReadUint32();
+    if (version < CALL_SNAPSHOT_VERSION || entrySize == 0 ||
+        static_cast<uint64_t>(entrySize) * entryNum > static_cast<uint64_t>(INT32_MAX)) {
+        TELEPHONY_LOGE("invalid call snapshot, version:%{public}u, entrySize:%{public}u, entryNum:%{public}u",
+            version, entrySize, entryNum);
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    return ReadCallSnapshotEntries(replyParcel, entrySize, entryNum, callList);
+}
+
+int32_t CallManagerServiceProxy::ReadCallSnapshotEntries(
+    MessageParcel &replyParcel, uint32_t entrySize, uint32_t entryNum, std::vector<CallSnapshotInfo> &callList)
+{
+    int32_t length = static_cast<int32_t>(entrySize * entryNum);
+    int32_t transport = replyParcel.ReadInt32();
+    if (transport == CALL_SNAPSHOT_TRANSPORT_PARCEL) {
+        if (replyParcel.ReadInt32() != length) {
+            TELEPHONY_LOGE("call snapshot length mismatch");
+            return TELEPHONY_ERR_READ_DATA_FAIL;
+        }
+        const void *data = (length > 0) ? replyParcel.ReadRawData(length) : nullptr;
+        return CopyCallSnapshotEntries(data, entrySize, entryNum, callList);
+    }
+    if (transport != CALL_SNAPSHOT_TRANSPORT_ASHMEM) {
+        TELEPHONY_LOGE("unknown call snapshot transport:%{public}d", transport);
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    sptr<Ashmem> ashmem = replyParcel.ReadAshmem();
+    if (ashmem == nullptr) {
+        TELEPHONY_LOGE("read ashmem failed");
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    int32_t result = TELEPHONY_ERR_READ_DATA_FAIL;
+    if (ashmem->GetAshmemSize() >= length && ashmem->MapReadOnlyAshmem()) {
+        result = CopyCallSnapshotEntries(ashmem->ReadFromAshmem(length, 0), entrySize, entryNum, callList);
+        ashmem->UnmapAshmem();
+    }
+    ashmem->CloseAshmem();
+    return result;
+}
+
+int32_t CallManagerServiceProxy::CopyCallSnapshotEntries(
+    const void *data, uint32_t entrySize, uint32_t entryNum, std::vector<CallSnapshotInfo> &callList)
+{
+    if (entryNum > 0 && data == nullptr) {
+        TELEPHONY_LOGE("call snapshot data is nullptr");
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    // fields unknown to an older writer stay zeroed, the extra fields of a newer writer are skipped
+    size_t copySize = std::min(static_cast<size_t>(entrySize), sizeof(CallSnapshotInfo));
+    callList.resize(entryNum);
+    for (uint32_t i = 0; i < entryNum; ++i) {
+        (void)memset_s(&callList[i], sizeof(CallSnapshotInfo), 0, sizeof(CallSnapshotInfo));
+        if (memcpy_s(&callList[i], sizeof(CallSnapshotInfo), static_cast<const uint8_t *>(data) + i * entrySize,
+            copySize) != EOK) {
+            TELEPHONY_LOGE("memcpy_s failed");
+            callList.clear();
+            return TELEPHONY_ERR_MEMCPY_FAIL;
+        }
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallManagerServiceProxy::GetImsConfig(int32_t slotId, ImsConfigItem item)
 {
     MessageOption option;
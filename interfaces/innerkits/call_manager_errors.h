@@ -99,6 +99,7 @@ enum CallManagerErrorCode {
     CALL_ERR_SERVICE_DUMP_FAILED,
     CALL_ERR_FUNCTION_NOT_SUPPORTED,
     CALL_ERR_VIDEO_NOT_SUPPORTED,
+    CALL_ERR_CELLULAR_CALL_RESPONSE_TIMEOUT,
 };
 
 // 3GPP TS 24.008 V3.9.0 (2001-09)  10.5.4.11 Cause
@@ -29,6 +29,14 @@ constexpr uint16_t REJECT_CALL_MSG_MAX_LEN = 300;
 constexpr uint16_t ACCOUNT_NUMBER_MAX_LENGTH = 100;
 constexpr uint16_t CONNECT_SERVICE_WAIT_TIME = 1000; // ms
 constexpr int16_t ERR_ID = -1;
+constexpr uint16_t DTMF_STRING_MAX_LEN = 100;
+// on and off lengths of every tone of a DTMF string, passing 0 selects the default length
+constexpr int32_t DTMF_DEFAULT_ON_LENGTH = 150; // ms
+constexpr int32_t DTMF_DEFAULT_OFF_LENGTH = 70; // ms
+constexpr int32_t DTMF_MIN_LENGTH = 40; // ms
+constexpr int32_t DTMF_MAX_LENGTH = 1000; // ms
+// a pause character, P, p or ',', holds the following digits for this long
+constexpr int32_t DTMF_PAUSE_LENGTH = 3000; // ms
 
 // call type
 enum class CallType {
@@ -163,6 +171,11 @@ struct CallAttributeInfo {
     CallAnswerType answerType;
 };
 
+struct CallSnapshotInfo {
+    CallAttributeInfo info;
+    int32_t mainCallId; // host of the conference the call is in, the call itself if it is in no conference
+};
+
 struct CallRecordInfo {
     int32_t callId;
     char phoneNumber[kMaxNumberLen + 1];
@@ -338,6 +351,7 @@ enum class CallResultReportId {
     SET_LTE_ENHANCE_MODE_REPORT_ID,
     INVITE_TO_CONFERENCE_REPORT_ID,
     UPDATE_MEDIA_MODE_REPORT_ID,
+    SEND_DTMF_STRING_REPORT_ID,
 };
 
 struct CellularCallEventInfo {
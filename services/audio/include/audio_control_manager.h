@@ -47,6 +47,9 @@ public:
     int32_t StopWaitingTone();
     int32_t PlayCallTone(ToneDescriptor type);
     int32_t StopCallTone();
+    // local feedback of the DTMF tones sent to the network, kept apart from the call tone
+    int32_t PlayDtmfTone(char digit);
+    int32_t StopDtmfTone();
     int32_t MuteRinger();
     int32_t SetMute(bool on);
     void SetVolumeAudible();
@@ -88,6 +91,7 @@ private:
     std::set<sptr<CallBase>> totalCalls_;
     std::unique_ptr<Ring> ring_;
     std::unique_ptr<Tone> tone_;
+    std::unique_ptr<Tone> dtmfTone_;
 };
 } // namespace Telephony
 } // namespace OHOS
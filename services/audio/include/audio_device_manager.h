@@ -18,10 +18,9 @@
 
 #include "audio_base.h"
 
-#include <map>
-
 #include "singleton.h"
 
+#include "call_dispatch_table.h"
 #include "call_manager_inner_type.h"
 
 namespace OHOS {
@@ -59,7 +58,7 @@ private:
     static bool isBtScoConnected_;
     bool isAudioActivated_;
     using AudioDeviceManagerFunc = bool (AudioDeviceManager::*)();
-    std::map<uint32_t, AudioDeviceManagerFunc> memberFuncMap_;
+    static const CallDispatchTable<AudioDeviceManagerFunc, AUDIO_EVENT_NUM> memberFuncTable_;
     bool SwitchDevice(AudioEvent event);
     bool EnableBtSco();
     bool EnableWiredHeadset();
@@ -18,10 +18,9 @@
 
 #include "audio_base.h"
 
-#include <map>
-
 #include "singleton.h"
 #include "audio_proxy.h"
+#include "call_dispatch_table.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -61,7 +60,7 @@ private:
     AudioStandard::AudioScene currentAudioScene_;
     std::unique_ptr<AudioBase> currentState_;
     using AudioSceneProcessorFunc = bool (AudioSceneProcessor::*)();
-    std::map<uint32_t, AudioSceneProcessorFunc> memberFuncMap_;
+    static const CallDispatchTable<AudioSceneProcessorFunc, AUDIO_EVENT_NUM> memberFuncTable_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -57,6 +57,8 @@ enum AudioEvent {
     INIT_AUDIO_DEVICE
 };
 
+constexpr uint32_t AUDIO_EVENT_NUM = INIT_AUDIO_DEVICE + 1;
+
 class AudioBase {
 public:
     AudioBase() {}
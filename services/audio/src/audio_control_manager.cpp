@@ -19,11 +19,12 @@
 #include "telephony_log_wrapper.h"
 
 #include "call_control_manager.h"
+#include "call_perf_statistics.h"
 
 namespace OHOS {
 namespace Telephony {
 AudioControlManager::AudioControlManager()
-    : isTonePlaying_(false), isLocalRingbackNeeded_(false), ring_(nullptr), tone_(nullptr)
+    : isTonePlaying_(false), isLocalRingbackNeeded_(false), ring_(nullptr), tone_(nullptr), dtmfTone_(nullptr)
 {}
 
 AudioControlManager::~AudioControlManager() {}
@@ -206,6 +207,7 @@ bool AudioControlManager::PlayRingtone()
         TELEPHONY_LOGE("create ring object failed");
         return false;
     }
+    CallPerfTimer timer(CALL_PERF_TIMER_RINGTONE_START);
     if (ring_->Play() != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("play ringtone failed");
         return false;
@@ -229,6 +231,7 @@ bool AudioControlManager::PlayRingtone(const std::string &phoneNum)
         TELEPHONY_LOGE("create ring failed");
         return false;
     }
+    CallPerfTimer timer(CALL_PERF_TIMER_RINGTONE_START);
     if (ring_->Play() != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("play ringtone failed");
         return false;
@@ -252,6 +255,7 @@ bool AudioControlManager::PlayRingtone(const std::string &phoneNum, const std::s
         TELEPHONY_LOGE("create ring failed");
         return false;
     }
+    CallPerfTimer timer(CALL_PERF_TIMER_RINGTONE_START);
     if (ring_->Play() == TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("play ringtone failed");
         return false;
@@ -299,6 +303,11 @@ void AudioControlManager::SetAudioInterruptState(AudioInterruptState state)
     if (event == AudioEvent::UNKNOWN_EVENT) {
         return;
     }
+    if (event == AudioEvent::AUDIO_ACTIVATED) {
+        CallPerfTimer timer(CALL_PERF_TIMER_AUDIO_ACTIVATE);
+        DelayedSingleton<AudioDeviceManager>::GetInstance()->ProcessEvent(event);
+        return;
+    }
     DelayedSingleton<AudioDeviceManager>::GetInstance()->ProcessEvent(event);
 }
 
@@ -484,6 +493,7 @@ int32_t AudioControlManager::PlayCallTone(ToneDescriptor type)
         TELEPHONY_LOGE("create tone failed");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
+    CallPerfTimer timer(CALL_PERF_TIMER_TONE_START);
     if (tone_->Play() == TELEPHONY_SUCCESS) {
         isTonePlaying_ = true;
         return TELEPHONY_SUCCESS;
@@ -507,6 +517,38 @@ int32_t AudioControlManager::StopCallTone()
     return CALL_ERR_AUDIO_TONE_STOP_FAILED;
 }
 
+int32_t AudioControlManager::PlayDtmfTone(char digit)
+{
+    ToneDescriptor type = Tone::ConvertDigitToTone(digit);
+    if (type == ToneDescriptor::TONE_UNKNOWN) {
+        return CALL_ERR_AUDIO_UNKNOWN_TONE;
+    }
+    dtmfTone_ = std::make_unique<Tone>(type);
+    if (dtmfTone_ == nullptr) {
+        TELEPHONY_LOGE("create dtmf tone failed");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    if (dtmfTone_->Play() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("play dtmf tone failed");
+        dtmfTone_ = nullptr;
+        return CALL_ERR_AUDIO_TONE_PLAY_FAILED;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t AudioControlManager::StopDtmfTone()
+{
+    if (dtmfTone_ == nullptr) {
+        return TELEPHONY_SUCCESS;
+    }
+    if (dtmfTone_->Stop() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("stop dtmf tone failed");
+        return CALL_ERR_AUDIO_TONE_STOP_FAILED;
+    }
+    dtmfTone_ = nullptr;
+    return TELEPHONY_SUCCESS;
+}
+
 bool AudioControlManager::IsTonePlaying() const
 {
     return isTonePlaying_;
@@ -33,21 +33,22 @@ bool AudioDeviceManager::isEarpieceAvailable_ = false;
 bool AudioDeviceManager::isWiredHeadsetConnected_ = false;
 bool AudioDeviceManager::isBtScoConnected_ = false;
 
+constexpr CallDispatchTable<AudioDeviceManager::AudioDeviceManagerFunc, AUDIO_EVENT_NUM>
+    AudioDeviceManager::memberFuncTable_({
+        { AudioEvent::ENABLE_DEVICE_EARPIECE, &AudioDeviceManager::EnableEarpiece },
+        { AudioEvent::ENABLE_DEVICE_SPEAKER, &AudioDeviceManager::EnableSpeaker },
+        { AudioEvent::ENABLE_DEVICE_WIRED_HEADSET, &AudioDeviceManager::EnableWiredHeadset },
+        { AudioEvent::ENABLE_DEVICE_BLUETOOTH, &AudioDeviceManager::EnableBtSco },
+    });
+
 AudioDeviceManager::AudioDeviceManager()
     : audioDevice_(AudioDevice::DEVICE_UNKNOWN), currentAudioDevice_(nullptr), isAudioActivated_(false)
 {}
 
-AudioDeviceManager::~AudioDeviceManager()
-{
-    memberFuncMap_.clear();
-}
+AudioDeviceManager::~AudioDeviceManager() {}
 
 void AudioDeviceManager::Init()
 {
-    memberFuncMap_[AudioEvent::ENABLE_DEVICE_EARPIECE] = &AudioDeviceManager::EnableEarpiece;
-    memberFuncMap_[AudioEvent::ENABLE_DEVICE_SPEAKER] = &AudioDeviceManager::EnableSpeaker;
-    memberFuncMap_[AudioEvent::ENABLE_DEVICE_WIRED_HEADSET] = &AudioDeviceManager::EnableWiredHeadset;
-    memberFuncMap_[AudioEvent::ENABLE_DEVICE_BLUETOOTH] = &AudioDeviceManager::EnableBtSco;
     currentAudioDevice_ = std::make_unique<InactiveDeviceState>();
     if (currentAudioDevice_ == nullptr) {
         TELEPHONY_LOGE("current audio device nullptr");
@@ -108,9 +109,8 @@ bool AudioDeviceManager::ProcessEvent(AudioEvent event)
 
 bool AudioDeviceManager::SwitchDevice(AudioEvent event)
 {
-    auto itFunc = memberFuncMap_.find(event);
-    if (itFunc != memberFuncMap_.end() && itFunc->second != nullptr) {
-        auto memberFunc = itFunc->second;
+    auto memberFunc = memberFuncTable_.Find(event);
+    if (memberFunc != nullptr) {
         return (this->*memberFunc)();
     }
     return false;
@@ -27,6 +27,16 @@
 
 namespace OHOS {
 namespace Telephony {
+constexpr CallDispatchTable<AudioSceneProcessor::AudioSceneProcessorFunc, AUDIO_EVENT_NUM>
+    AudioSceneProcessor::memberFuncTable_({
+        { AudioEvent::SWITCH_ALERTING_STATE, &AudioSceneProcessor::SwitchAlerting },
+        { AudioEvent::SWITCH_INCOMING_STATE, &AudioSceneProcessor::SwitchIncoming },
+        { AudioEvent::SWITCH_CS_CALL_STATE, &AudioSceneProcessor::SwitchCS },
+        { AudioEvent::SWITCH_IMS_CALL_STATE, &AudioSceneProcessor::SwitchIMS },
+        { AudioEvent::SWITCH_HOLDING_STATE, &AudioSceneProcessor::SwitchHolding },
+        { AudioEvent::SWITCH_AUDIO_INACTIVE_STATE, &AudioSceneProcessor::SwitchInactive },
+    });
+
 AudioSceneProcessor::AudioSceneProcessor()
     : currentAudioScene_(AudioStandard::AudioScene::AUDIO_SCENE_DEFAULT), currentState_(nullptr)
 {}
@@ -35,12 +45,6 @@ AudioSceneProcessor::~AudioSceneProcessor() {}
 
 int32_t AudioSceneProcessor::Init()
 {
-    memberFuncMap_[AudioEvent::SWITCH_ALERTING_STATE] = &AudioSceneProcessor::SwitchAlerting;
-    memberFuncMap_[AudioEvent::SWITCH_INCOMING_STATE] = &AudioSceneProcessor::SwitchIncoming;
-    memberFuncMap_[AudioEvent::SWITCH_CS_CALL_STATE] = &AudioSceneProcessor::SwitchCS;
-    memberFuncMap_[AudioEvent::SWITCH_IMS_CALL_STATE] = &AudioSceneProcessor::SwitchIMS;
-    memberFuncMap_[AudioEvent::SWITCH_HOLDING_STATE] = &AudioSceneProcessor::SwitchHolding;
-    memberFuncMap_[AudioEvent::SWITCH_AUDIO_INACTIVE_STATE] = &AudioSceneProcessor::SwitchInactive;
     currentState_ = std::make_unique<InActiveState>();
     if (currentState_ == nullptr) {
         TELEPHONY_LOGE("current call state nullptr");
@@ -82,9 +86,8 @@ bool AudioSceneProcessor::ProcessEvent(AudioEvent event)
 
 bool AudioSceneProcessor::SwitchState(AudioEvent event)
 {
-    auto itFunc = memberFuncMap_.find(event);
-    if (itFunc != memberFuncMap_.end() && itFunc->second != nullptr) {
-        auto memberFunc = itFunc->second;
+    auto memberFunc = memberFuncTable_.Find(event);
+    if (memberFunc != nullptr) {
         return (this->*memberFunc)();
     }
     return false;
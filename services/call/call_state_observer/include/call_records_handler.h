@@ -23,6 +23,7 @@
 #include "event_runner.h"
 #include "singleton.h"
 
+#include "call_perf_statistics.h"
 #include "call_status_manager.h"
 #include "call_data_base_helper.h"
 
@@ -48,6 +49,12 @@ public:
     };
 
 private:
+    template<typename... Args>
+    bool SendHandlerEvent(Args &&...args)
+    {
+        return CallPerfStatistics::SendEvent(CALL_EVENT_QUEUE_RECORDS, *handler_, std::forward<Args>(args)...);
+    }
+
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<CallRecordsHandler> handler_;
 };
@@ -35,8 +35,9 @@ class CallRecordsManager : public CallStateListenerBase {
     DECLARE_DELAYED_SINGLETON(CallRecordsManager)
 public:
     void Init();
-    void CallStateUpdated(sptr<CallBase> &callObjectPtr, TelCallState priorState, TelCallState nextState) override;
-    void AddOneCallRecord(CallAttributeInfo &info);
+    void CallSnapshotUpdated(sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info, TelCallState priorState,
+        TelCallState nextState) override;
+    void AddOneCallRecord(const CallAttributeInfo &info);
     void AddOneCallRecord(sptr<CallBase> call, CallAnswerType answerType);
 
 private:
@@ -26,7 +26,7 @@ class MissedCallNotification : public CallStateListenerBase {
 public:
     MissedCallNotification();
     ~MissedCallNotification() = default;
-    void NewCallCreated(sptr<CallBase> &callObjectPtr) override;
+    void NewCallSnapshotCreated(sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info) override;
     void CallDestroyed(int32_t cause) override;
     void IncomingCallActivated(sptr<CallBase> &callObjectPtr) override;
     void IncomingCallHungUp(sptr<CallBase> &callObjectPtr, bool isSendSms, std::string content) override;
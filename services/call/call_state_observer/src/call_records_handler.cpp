@@ -34,6 +34,7 @@ void CallRecordsHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &eve
         TELEPHONY_LOGE("CallRecordsHandler::ProcessEvent parameter error");
         return;
     }
+    CallPerfStatistics::OnEventProcessed(CALL_EVENT_QUEUE_RECORDS);
     if (event->GetInnerEventId() == CallRecordsHandlerService::HANDLER_ADD_CALL_RECORD_INFO) {
         auto object = event->GetUniqueObject<CallRecordInfo>();
         if (object == nullptr) {
@@ -104,7 +105,7 @@ int32_t CallRecordsHandlerService::StoreCallRecord(const CallRecordInfo &info)
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = info;
-    handler_->SendEvent(HANDLER_ADD_CALL_RECORD_INFO, std::move(para));
+    SendHandlerEvent(HANDLER_ADD_CALL_RECORD_INFO, std::move(para));
     return TELEPHONY_SUCCESS;
 }
 } // namespace Telephony
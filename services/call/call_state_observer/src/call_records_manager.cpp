@@ -37,20 +37,13 @@ void CallRecordsManager::Init()
     callRecordsHandlerServerPtr_->Start();
 }
 
-void CallRecordsManager::CallStateUpdated(
-    sptr<CallBase> &callObjectPtr, TelCallState priorState, TelCallState nextState)
+void CallRecordsManager::CallSnapshotUpdated(
+    sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info, TelCallState priorState, TelCallState nextState)
 {
-    CallAttributeInfo info;
     if (nextState != TelCallState::CALL_STATUS_DISCONNECTED) {
         TELEPHONY_LOGE("nextState not CALL_STATUS_DISCONNECTED");
         return;
     }
-    if (callObjectPtr == nullptr) {
-        TELEPHONY_LOGE("call object is nullptr");
-        return;
-    }
-    (void)memset_s(&info, sizeof(CallAttributeInfo), 0, sizeof(CallAttributeInfo));
-    callObjectPtr->GetCallAttributeBaseInfo(info);
     AddOneCallRecord(info);
 }
 
@@ -62,7 +55,7 @@ void CallRecordsManager::AddOneCallRecord(sptr<CallBase> call, CallAnswerType an
     AddOneCallRecord(info);
 }
 
-void CallRecordsManager::AddOneCallRecord(CallAttributeInfo &info)
+void CallRecordsManager::AddOneCallRecord(const CallAttributeInfo &info)
 {
     CallRecordInfo data;
     (void)memset_s(&data, sizeof(CallRecordInfo), 0, sizeof(CallRecordInfo));
@@ -31,11 +31,10 @@ namespace OHOS {
 namespace Telephony {
 MissedCallNotification::MissedCallNotification() : isIncomingCallMissed_(true), incomingCallNumber_("") {}
 
-void MissedCallNotification::NewCallCreated(sptr<CallBase> &callObjectPtr)
+void MissedCallNotification::NewCallSnapshotCreated(sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info)
 {
-    if (callObjectPtr != nullptr && callObjectPtr->GetTelCallState() == TelCallState::CALL_STATUS_INCOMING &&
-        !callObjectPtr->GetAccountNumber().empty()) {
-        incomingCallNumber_ = callObjectPtr->GetAccountNumber();
+    if (info.callState == TelCallState::CALL_STATUS_INCOMING && info.accountNumber[0] != '\0') {
+        incomingCallNumber_ = info.accountNumber;
     } else {
         incomingCallNumber_ = "";
     }
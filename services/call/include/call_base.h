@@ -17,6 +17,7 @@
 #define CALL_BASE_H
 
 #include <unistd.h>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <mutex>
@@ -50,7 +51,9 @@ public:
     virtual bool GetEmergencyState() = 0;
     virtual int32_t StartDtmf(char str) = 0;
     virtual int32_t StopDtmf() = 0;
+    virtual int32_t SendDtmfString(const std::string &dtmfString, int32_t onLength, int32_t offLength) = 0;
     virtual int32_t GetSlotId() = 0;
+    virtual int32_t GetCallIndex() = 0;
     virtual int32_t CombineConference() = 0;
     virtual int32_t SeparateConference() = 0;
     virtual int32_t CanCombineConference() = 0;
@@ -67,6 +70,7 @@ public:
     int32_t AnswerCallBase();
     int32_t RejectCallBase();
     void GetCallAttributeBaseInfo(CallAttributeInfo &info);
+    std::shared_ptr<const CallAttributeInfo> GetCallAttributeSnapshot();
     int32_t GetCallID();
     CallType GetCallType();
     CallRunningState GetCallRunningState();
@@ -92,28 +96,35 @@ public:
     bool IsAliveState();
 
 protected:
+    void InvalidateCallAttributeSnapshot();
+
     int32_t callId_;
     CallType callType_;
-    VideoStateType videoState_;
     std::string accountNumber_;
     std::string bundleName_;
 
 private:
-    void StateChangesToDialing();
+    struct CallAttributeSnapshot {
+        uint64_t version;
+        CallAttributeInfo info;
+    };
+
     void StateChangesToIncoming();
     void StateChangesToWaiting();
     void StateChangesToActive();
-    void StateChangesToHolding();
     void StateChangesToDisconnected();
     void StateChangesToDisconnecting();
     void StateChangesToAlerting();
+    void SetCallRunningState(CallRunningState callRunningState);
+    template<typename Function>
+    uint64_t UpdateStateWord(Function func);
+    static uint64_t TransferStateWord(uint64_t word, TelCallState nextState);
 
-    CallRunningState callRunningState_;
-    TelConferenceState conferenceState_;
+    // running state, TelCallState, conference state, video state and policy flags packed in one word,
+    // read without mutex_ and always modified with CAS
+    std::atomic<uint64_t> stateWord_;
     int64_t startTime_; // Call start time
     CallDirection direction_;
-    uint64_t policyFlag_;
-    TelCallState callState_;
     bool isSpeakerphoneOn_;
     CallEndedType callEndedType_;
     ContactInfo contactInfo_;
@@ -122,6 +133,10 @@ private:
     time_t ringBeginTime_;
     time_t ringEndTime_;
     CallAnswerType answerType_;
+    // bumped after every change to a field reported in CallAttributeInfo
+    std::atomic<uint64_t> attributeVersion_;
+    // built on demand by GetCallAttributeSnapshot and shared by all observers of the same version
+    std::shared_ptr<const CallAttributeSnapshot> attributeSnapshot_;
     std::mutex mutex_;
 };
 } // namespace Telephony
@@ -18,11 +18,12 @@
 
 #include <string>
 #include <vector>
-#include <map>
 
 #include "common_event.h"
 #include "common_event_manager.h"
 
+#include "call_dispatch_table.h"
+
 namespace OHOS {
 namespace Telephony {
 const std::string SIM_STATE_UPDATE_ACTION = "com.hos.action.SIM_STATE_CHANGED";
@@ -36,12 +37,13 @@ private:
     enum {
         UNKNOWN_BROADCAST_EVENT = 0,
         SIM_STATE_BROADCAST_EVENT,
+        BROADCAST_EVENT_NUM,
     };
     using broadcastSubscriberFunc = void (CallBroadcastSubscriber::*)(const EventFwk::CommonEventData &data);
 
     void UnknownBroadcast(const EventFwk::CommonEventData &data);
     void SimStateBroadcast(const EventFwk::CommonEventData &data);
-    std::map<uint32_t, broadcastSubscriberFunc> memberFuncMap_;
+    static const CallDispatchTable<broadcastSubscriberFunc, BROADCAST_EVENT_NUM> memberFuncTable_;
 };
 } // namespace Telephony
 } // namespace OHOS
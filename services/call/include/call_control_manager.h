@@ -47,6 +47,10 @@ public:
     int32_t AnswerCall(int32_t callId, int32_t videoState);
     int32_t RejectCall(int32_t callId, bool rejectWithMessage, std::u16string textMessage);
     int32_t HangUpCall(int32_t callId);
+    int32_t AnswerAndHoldActiveCall(int32_t callId, int32_t videoState);
+    int32_t AnswerAndEndActiveCall(int32_t callId, int32_t videoState);
+    int32_t HangUpAllCall();
+    int32_t HangUpAllCallOnSlot(int32_t slotId);
     int32_t GetCallState();
     int32_t HoldCall(int32_t callId);
     int32_t UnHoldCall(int32_t callId);
@@ -63,6 +67,7 @@ public:
     bool NotifyCallEventUpdated(CallEventInfo &info);
     int32_t StartDtmf(int32_t callId, char str);
     int32_t StopDtmf(int32_t callId);
+    int32_t SendDtmfString(int32_t callId, const std::string &dtmfString, int32_t onLength, int32_t offLength);
     int32_t GetCallWaiting(int32_t slotId);
     int32_t SetCallWaiting(int32_t slotId, bool activate);
     int32_t GetCallRestriction(int32_t slotId, CallRestrictionType type);
@@ -76,6 +81,7 @@ public:
     int32_t GetMainCallId(int32_t callId);
     std::vector<std::u16string> GetSubCallIdList(int32_t callId);
     std::vector<std::u16string> GetCallIdListForConference(int32_t callId);
+    int32_t GetCallSnapshot(std::vector<CallSnapshotInfo> &callList);
     int32_t GetImsConfig(int32_t slotId, ImsConfigItem item);
     int32_t SetImsConfig(int32_t slotId, ImsConfigItem item, std::u16string &value);
     int32_t GetImsFeatureValue(int32_t slotId, FeatureType type);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_ID_ALLOCATOR_H
+#define CALL_ID_ALLOCATOR_H
+
+#include <bitset>
+#include <chrono>
+#include <mutex>
+
+#include "common_type.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @ClassName:CallIdAllocator
+ * @Description:hands out call ids from the bounded range (CALL_START_ID, CALL_ID_SPACE_SIZE).
+ * A released id stays in quarantine for CALL_ID_QUARANTINE_MS before it is handed out again,
+ * so late reports and callbacks for an ended call cannot be mistaken for a new one.
+ */
+class CallIdAllocator {
+public:
+    CallIdAllocator();
+    ~CallIdAllocator() = default;
+    int32_t Allocate();
+    bool Reserve(int32_t callId);
+    void Release(int32_t callId);
+
+private:
+    bool IsValidCallId(int32_t callId);
+    bool IsInQuarantine(int32_t callId, std::chrono::steady_clock::time_point now);
+
+    std::mutex mutex_;
+    std::bitset<CALL_ID_SPACE_SIZE> inUse_;
+    std::bitset<CALL_ID_SPACE_SIZE> released_;
+    std::chrono::steady_clock::time_point releaseTime_[CALL_ID_SPACE_SIZE];
+    int32_t lastCallId_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_ID_ALLOCATOR_H
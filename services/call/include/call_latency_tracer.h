@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CALL_LATENCY_TRACER_H
+#define CALL_LATENCY_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace Telephony {
+// each power of two of the latency is split into 4 buckets, so a percentile is off by at most a quarter
+constexpr uint32_t CALL_LATENCY_SUB_BUCKET_BITS = 2;
+constexpr uint32_t CALL_LATENCY_SUB_BUCKET_NUM = 1 << CALL_LATENCY_SUB_BUCKET_BITS;
+// latencies from 2^31 microseconds on all land in the last power of two
+constexpr uint32_t CALL_LATENCY_MAX_EXPONENT = 31;
+constexpr uint32_t CALL_LATENCY_BUCKET_NUM =
+    (CALL_LATENCY_MAX_EXPONENT - CALL_LATENCY_SUB_BUCKET_BITS + 2) * CALL_LATENCY_SUB_BUCKET_NUM;
+
+enum CallLatencyStage : uint32_t {
+    // uplink, a state report of the cellular call service on its way to the apps
+    CALL_LATENCY_STAGE_REPORT_QUEUE = 0, // CallStatusCallback until ReportCallInfoHandler runs it
+    CALL_LATENCY_STAGE_REPORT_HANDLE, // CallStatusManager until CallStateListener dispatches it
+    CALL_LATENCY_STAGE_REPORT_OBSERVER, // the critical observers until CallAbilityReportProxy
+    CALL_LATENCY_STAGE_REPORT_IPC, // OnCallDetailsChange of all registered apps
+    CALL_LATENCY_STAGE_REPORT_TOTAL,
+    // downlink, a dial request of an app on its way to the cellular call service
+    CALL_LATENCY_STAGE_DIAL_QUEUE, // OnDialCall until CallRequestHandler runs it
+    CALL_LATENCY_STAGE_DIAL_HANDLE, // the dial policy and call creation until CellularCallConnection
+    CALL_LATENCY_STAGE_DIAL_IPC, // Dial of the cellular call service
+    CALL_LATENCY_STAGE_DIAL_TOTAL,
+    CALL_LATENCY_STAGE_NUM,
+};
+
+/**
+ * @ClassName:CallLatencyHistogram
+ * @Description:log-linear histogram of latencies in microseconds. Recording is a few relaxed
+ * atomic adds, so it can be done on every event of every thread without a lock.
+ */
+class CallLatencyHistogram {
+public:
+    void Record(int64_t latencyUs);
+    uint64_t GetCount() const;
+    int64_t GetPercentile(uint32_t percent) const;
+    int64_t GetMax() const;
+    // adds the latencies of a histogram recorded by another thread, used to sum per thread shards
+    void Merge(const CallLatencyHistogram &other);
+    void Dump(std::string &result) const;
+
+private:
+    static uint32_t GetBucketIndex(int64_t latencyUs);
+    static int64_t GetBucketUpperBound(uint32_t bucketIndex);
+
+    std::atomic<uint64_t> buckets_[CALL_LATENCY_BUCKET_NUM] = {};
+    std::atomic<uint64_t> count_ = {0};
+    std::atomic<int64_t> max_ = {0};
+};
+
+/**
+ * @ClassName:CallLatencyTracer
+ * @Description:traces call events through the stages of the service. The thread that takes an
+ * event in opens a CallLatencyTraceScope, the begin time travels with the event to the handler
+ * thread, and each stage then records the time since the previous one. Nothing is recorded on
+ * a thread without an open trace, so shared code paths cost a thread local check.
+ */
+class CallLatencyTracer {
+public:
+    static int64_t GetTraceTime();
+    static int64_t GetElapsedTime(int64_t beginTime);
+    static int64_t GetTraceBeginTime();
+    static void MarkStage(CallLatencyStage stage);
+    static void EndTrace(CallLatencyStage stage, CallLatencyStage totalStage);
+    static void Dump(std::string &result);
+
+private:
+    friend class CallLatencyTraceScope;
+    static CallLatencyHistogram histograms_[CALL_LATENCY_STAGE_NUM];
+};
+
+class CallLatencyTraceScope {
+public:
+    // a begin time of 0 comes from an event sent without a trace, then the scope does nothing
+    explicit CallLatencyTraceScope(int64_t beginTime);
+    ~CallLatencyTraceScope();
+
+private:
+    int64_t priorBeginTime_;
+    int64_t priorStageTime_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_LATENCY_TRACER_H
@@ -16,20 +16,31 @@
 #ifndef CALL_OBJECT_MANAGER_H
 #define CALL_OBJECT_MANAGER_H
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "refbase.h"
 
 #include "call_base.h"
+#include "call_id_allocator.h"
 #include "common_type.h"
 #include "call_manager_inner_type.h"
 
 namespace OHOS {
 namespace Telephony {
+constexpr size_t CALL_RUNNING_STATE_NUM = static_cast<size_t>(CallRunningState::CALL_RUNNING_STATE_ENDING) + 1;
+constexpr size_t TEL_CALL_STATE_NUM = static_cast<size_t>(TelCallState::CALL_STATUS_IDLE) + 1;
+// one registry shard per SIM slot plus one for calls that belong to no slot
+constexpr int32_t CALL_SLOT_SHARD_NUM = 2;
+constexpr int32_t CALL_SHARD_NUM = CALL_SLOT_SHARD_NUM + 1;
+
 class CallObjectManager {
 public:
     CallObjectManager();
@@ -40,16 +51,22 @@ public:
     static void DeleteOneCallObject(sptr<CallBase> &call);
     static sptr<CallBase> GetOneCallObject(int32_t callId);
     static sptr<CallBase> GetOneCallObject(std::string &phoneNumber);
+    static sptr<CallBase> GetOneCallObject(int32_t slotId, int32_t index);
     static int32_t HasNewCall();
     static bool IsNewCallAllowedCreate();
     static int32_t GetCarrierCallList(std::list<int32_t> &list);
+    static int32_t GetAllCallList(std::list<sptr<CallBase>> &list);
     static bool HasRingingMaximum();
     static bool HasDialingMaximum();
     static bool HasEmergencyCall();
     static int32_t GetNewCallId();
+    static bool ReserveCallId(int32_t callId);
+    static void RecycleCallId(int32_t callId);
+    static int32_t GetCallIdSpaceSize();
     static bool IsCallExist(int32_t callId);
     static bool IsCallExist(std::string &phoneNumber);
     static bool HasCallExist();
+    static int32_t GetCallObjectNum();
     static bool HasRingingCall();
     static TelCallState GetCallState(int32_t callId);
     static sptr<CallBase> GetOneCallObject(CallRunningState callState);
@@ -60,10 +77,63 @@ public:
     static int32_t GetCallNum(TelCallState callState);
     static std::string GetCallNumber(TelCallState callState);
     static std::vector<CallAttributeInfo> GetCallInfoList(int32_t slotId);
+    static int32_t GetCallSnapshotInfoList(std::vector<CallSnapshotInfo> &callList);
+    static void OnCallStateChanged(int32_t callId);
+
+private:
+    struct CallStateRecord {
+        CallRunningState runningState;
+        TelCallState telCallState;
+    };
+    struct CallEntry {
+        uint64_t sequence; // order in which calls were added, comparable across shards
+        sptr<CallBase> call;
+    };
+    using CallSnapshot = std::vector<CallEntry>;
+    /**
+     * calls of one SIM slot, the last shard keeps the calls without a valid slot (OTT).
+     * All members are guarded by mutex, except snapshot which is read through atomic_load.
+     */
+    struct CallShard {
+        std::mutex mutex;
+        std::list<CallEntry> callList;
+        std::unordered_map<int32_t, CallEntry> callIdMap;
+        std::unordered_map<std::string, std::list<CallEntry>> callNumberMap;
+        std::unordered_map<uint64_t, sptr<CallBase>> callSlotIndexMap;
+        // states each call is currently counted under, kept in step with the global counters
+        std::unordered_map<int32_t, CallStateRecord> callStateRecordMap;
+        std::shared_ptr<const CallSnapshot> snapshot;
+    };
+
+    static void AddCallIndexes(CallShard &shard, const CallEntry &entry);
+    static void DeleteCallIndexes(CallShard &shard, const sptr<CallBase> &call);
+    static void RecordCallDestroyed(int32_t callId, std::unique_lock<std::mutex> &shardLock);
+    static void ClearCallShards();
+    static std::string NormalizeNumber(const std::string &phoneNumber);
+    static uint64_t GetSlotIndexKey(int32_t slotId, int32_t index);
+    static int32_t GetSlotShardIndex(int32_t slotId);
+    static int32_t GetCallShardIndex(const sptr<CallBase> &call);
+    static int32_t GetCallIdShardIndex(int32_t callId);
+    static void AddStateCount(const CallStateRecord &record);
+    static void SubStateCount(const CallStateRecord &record);
+    static int32_t GetRunningStateCount(CallRunningState state);
+    static int32_t GetTelCallStateCount(TelCallState state);
+    static void PublishCallSnapshot(CallShard &shard);
+    static std::shared_ptr<const CallSnapshot> GetCallSnapshot(const CallShard &shard);
+    template<typename Predicate>
+    static sptr<CallBase> FindCall(Predicate predicate, bool isLatest);
+    static void GetAllCallEntries(std::vector<CallEntry> &entries);
+
 private:
-    static std::list<sptr<CallBase>> callObjectPtrList_;
-    static std::mutex listMutex_;
-    static int32_t callId_;
+    static CallShard callShards_[CALL_SHARD_NUM];
+    // cross-slot view: shard index + 1 of every registered call id, 0 if the id is not registered
+    static std::atomic<int32_t> callIdShardIndex_[CALL_ID_SPACE_SIZE];
+    static std::atomic<uint64_t> callSequence_;
+    static std::atomic<int32_t> callCount_;
+    // written under the shard mutex, read without it by the state predicates
+    static std::atomic<int32_t> runningStateCount_[CALL_RUNNING_STATE_NUM];
+    static std::atomic<int32_t> telCallStateCount_[TEL_CALL_STATE_NUM];
+    static CallIdAllocator callIdAllocator_;
 };
 } // namespace Telephony
 } // namespace OHOS
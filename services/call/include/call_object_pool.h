@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_OBJECT_POOL_H
+#define CALL_OBJECT_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace OHOS {
+namespace Telephony {
+constexpr size_t CALL_OBJECT_POOL_SIZE = 16;
+constexpr size_t VIDEO_STATE_POOL_SIZE = 16;
+
+struct CallObjectPoolStatistics {
+    uint64_t poolAllocCount;
+    uint64_t heapAllocCount;
+    uint64_t inUseCount;
+};
+
+/**
+ * @ClassName:FixedBlockPool
+ * @Description:a preallocated set of equally sized blocks, handed out from a free list.
+ * When all blocks are in use the request falls back to the general purpose heap.
+ */
+template<size_t BLOCK_SIZE, size_t BLOCK_NUM>
+class FixedBlockPool {
+public:
+    FixedBlockPool() : freeTop_(BLOCK_NUM), poolAllocCount_(0), heapAllocCount_(0), inUseCount_(0)
+    {
+        for (size_t i = 0; i < BLOCK_NUM; ++i) {
+            freeList_[i] = BLOCK_NUM - 1 - i;
+        }
+    }
+    ~FixedBlockPool() = default;
+
+    void *Allocate(size_t size)
+    {
+        if (size <= BLOCK_SIZE) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (freeTop_ > 0) {
+                size_t index = freeList_[--freeTop_];
+                ++poolAllocCount_;
+                ++inUseCount_;
+                return blocks_[index].data;
+            }
+        }
+        ++heapAllocCount_;
+        return ::operator new(size);
+    }
+
+    void Release(void *ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+        uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+        uintptr_t begin = reinterpret_cast<uintptr_t>(&blocks_[0]);
+        uintptr_t end = reinterpret_cast<uintptr_t>(&blocks_[BLOCK_NUM]);
+        if (addr < begin || addr >= end) {
+            ::operator delete(ptr);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        freeList_[freeTop_++] = (addr - begin) / sizeof(Block);
+        --inUseCount_;
+    }
+
+    CallObjectPoolStatistics GetStatistics()
+    {
+        CallObjectPoolStatistics statistics;
+        statistics.poolAllocCount = poolAllocCount_.load();
+        statistics.heapAllocCount = heapAllocCount_.load();
+        statistics.inUseCount = inUseCount_.load();
+        return statistics;
+    }
+
+private:
+    struct Block {
+        alignas(std::max_align_t) unsigned char data[BLOCK_SIZE];
+    };
+
+    std::mutex mutex_;
+    Block blocks_[BLOCK_NUM];
+    size_t freeList_[BLOCK_NUM];
+    size_t freeTop_;
+    std::atomic<uint64_t> poolAllocCount_;
+    std::atomic<uint64_t> heapAllocCount_;
+    std::atomic<uint64_t> inUseCount_;
+};
+
+/**
+ * @ClassName:PooledObject
+ * @Description:gives T a class specific operator new/delete backed by its own FixedBlockPool,
+ * so a block returns to the pool when the last sptr of the object drops.
+ */
+template<typename T, size_t POOL_SIZE>
+class PooledObject {
+public:
+    static void *operator new(size_t size)
+    {
+        return GetPool().Allocate(size);
+    }
+
+    static void operator delete(void *ptr)
+    {
+        GetPool().Release(ptr);
+    }
+
+    static CallObjectPoolStatistics GetPoolStatistics()
+    {
+        return GetPool().GetStatistics();
+    }
+
+private:
+    static auto &GetPool()
+    {
+        static FixedBlockPool<sizeof(T), POOL_SIZE> pool;
+        return pool;
+    }
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_OBJECT_POOL_H
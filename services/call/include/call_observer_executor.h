@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_OBSERVER_EXECUTOR_H
+#define CALL_OBSERVER_EXECUTOR_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "event_handler.h"
+#include "event_runner.h"
+#include "refbase.h"
+
+namespace OHOS {
+namespace Telephony {
+class CallStateListenerBase;
+
+enum CallObserverPriority {
+    // called on the reporting thread before the report returns, for audio and the UI callback
+    CALL_OBSERVER_PRIORITY_CRITICAL = 0,
+    // queued to the executor thread, for records, broadcasts, notifications and the like
+    CALL_OBSERVER_PRIORITY_BEST_EFFORT,
+};
+
+/**
+ * @ClassName:CallObserverExecutor
+ * @Description:runs the events of best-effort observers on a thread of its own. Every observer has
+ * its own queue with at most one task of it scheduled at a time, so each observer still sees its
+ * events in report order, and the queues take turns so a busy observer does not starve the others.
+ */
+class CallObserverExecutor {
+public:
+    CallObserverExecutor();
+    ~CallObserverExecutor();
+    void Start();
+    void Execute(const sptr<CallStateListenerBase> &observer, std::function<void()> task);
+    void RemoveObserver(const sptr<CallStateListenerBase> &observer);
+
+private:
+    struct ObserverQueue {
+        std::deque<std::function<void()>> tasks;
+        bool isScheduled = false;
+        // removed while a task of it is scheduled, the entry is erased when that task runs
+        bool isRemoved = false;
+    };
+    bool ScheduleQueue(const sptr<CallStateListenerBase> &observer);
+    void RunNextTask(const sptr<CallStateListenerBase> &observer);
+
+    std::mutex mutex_;
+    std::map<CallStateListenerBase *, ObserverQueue> queueMap_;
+    std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_OBSERVER_EXECUTOR_H
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CALL_PERF_STATISTICS_H
+#define CALL_PERF_STATISTICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "event_handler.h"
+
+#include "call_latency_tracer.h"
+
+namespace OHOS {
+namespace Telephony {
+enum CallEventQueueType : uint32_t {
+    CALL_EVENT_QUEUE_REQUEST = 0,
+    CALL_EVENT_QUEUE_REPORT,
+    CALL_EVENT_QUEUE_RECORDS,
+    CALL_EVENT_QUEUE_NUM,
+};
+
+enum CallPerfTimerType : uint32_t {
+    CALL_PERF_TIMER_CRITICAL_OBSERVER = 0,
+    CALL_PERF_TIMER_BEST_EFFORT_OBSERVER,
+    CALL_PERF_TIMER_RINGTONE_START,
+    CALL_PERF_TIMER_TONE_START,
+    CALL_PERF_TIMER_AUDIO_ACTIVATE,
+    CALL_PERF_TIMER_URGENT_REQUEST_WAIT,
+    CALL_PERF_TIMER_ANSWER_REQUEST_WAIT,
+    CALL_PERF_TIMER_NORMAL_REQUEST_WAIT,
+    CALL_PERF_TIMER_NUM,
+};
+
+/**
+ * @ClassName:CallPerfStatistics
+ * @Description:counters behind the -perf_dump command, the depth of the event queues and the
+ * time taken by observers and audio. Everything is kept in atomics so recording never blocks.
+ */
+class CallPerfStatistics {
+public:
+    // sends an event and counts it until the handler takes it, see OnEventProcessed
+    template<typename... Args>
+    static bool SendEvent(CallEventQueueType type, AppExecFwk::EventHandler &handler, Args &&...args)
+    {
+        OnEventQueued(type);
+        if (!handler.SendEvent(std::forward<Args>(args)...)) {
+            OnEventProcessed(type);
+            return false;
+        }
+        return true;
+    }
+    static void OnEventQueued(CallEventQueueType type);
+    static void OnEventProcessed(CallEventQueueType type);
+    static void RecordTime(CallPerfTimerType type, int64_t beginTime);
+    static void Dump(std::string &result);
+
+private:
+    static std::atomic<int32_t> queueDepth_[CALL_EVENT_QUEUE_NUM];
+    static std::atomic<int32_t> maxQueueDepth_[CALL_EVENT_QUEUE_NUM];
+    static CallLatencyHistogram timers_[CALL_PERF_TIMER_NUM];
+};
+
+class CallPerfTimer {
+public:
+    explicit CallPerfTimer(CallPerfTimerType type) : type_(type), beginTime_(CallLatencyTracer::GetTraceTime()) {}
+    ~CallPerfTimer()
+    {
+        CallPerfStatistics::RecordTime(type_, beginTime_);
+    }
+
+private:
+    CallPerfTimerType type_;
+    int64_t beginTime_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_PERF_STATISTICS_H
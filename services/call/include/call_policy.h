@@ -40,6 +40,9 @@ public:
     int32_t HoldCallPolicy(int32_t callId);
     int32_t UnHoldCallPolicy(int32_t callId);
     int32_t HangUpPolicy(int32_t callId);
+    int32_t AnswerAndHoldActivePolicy(int32_t callId, int32_t videoState);
+    int32_t HangUpAllPolicy();
+    int32_t HangUpAllOnSlotPolicy(int32_t slotId);
     int32_t SwitchCallPolicy(int32_t callId);
     static int32_t UpdateCallMediaModePolicy(int32_t callId, ImsCallMode mode);
     static int32_t StartRttPolicy(int32_t callId);
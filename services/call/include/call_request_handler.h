@@ -16,13 +16,15 @@
 #ifndef CALL_REQUEST_HANDLER_H
 #define CALL_REQUEST_HANDLER_H
 
-#include <map>
+#include <atomic>
 #include <memory>
 #include <mutex>
 
 #include "event_handler.h"
 #include "event_runner.h"
 
+#include "call_dispatch_table.h"
+#include "call_perf_statistics.h"
 #include "common_type.h"
 #include "call_request_process.h"
 
@@ -54,45 +56,36 @@ struct JoinConferencePara {
     std::vector<std::string> numberList;
 };
 
-/**
- * @ClassName: CallRequestHandler
- * @Description: inner event-handle mechanism on harmony platform, used by callcontrolmanager
- * to handle downflowed telephone business, factually act as work thread.
- */
-class CallRequestHandler : public AppExecFwk::EventHandler {
-public:
-    CallRequestHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
-    virtual ~CallRequestHandler();
-
-    void Init();
-    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+struct HangUpAllPara {
+    bool isAllSlots;
+    int32_t slotId;
+};
 
-private:
-    using CallRequestFunc = void (CallRequestHandler::*)(const AppExecFwk::InnerEvent::Pointer &event);
+struct HoldCallPara {
+    int32_t callId;
+    uint32_t hangUpSeq;
+    uint32_t hangUpAllSeq;
+};
 
-    void DialCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void AcceptCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void RejectCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void HangUpCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void HoldCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void UnHoldCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void SwitchCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void CombineConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void SeparateConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void UpdateCallMediaModeEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void StartRttEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void StopRttEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void JoinConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    std::map<uint32_t, CallRequestFunc> memberFuncMap_;
-    std::unique_ptr<CallRequestProcess> callRequestProcessPtr_;
+/**
+ * requests are handled lane by lane, a request never waits behind one of a lower lane.
+ * Emergency dial, hang up and reject go first, then answer, then everything else.
+ */
+enum CallRequestLane : uint32_t {
+    CALL_REQUEST_LANE_URGENT = 0,
+    CALL_REQUEST_LANE_ANSWER,
+    CALL_REQUEST_LANE_NORMAL,
+    CALL_REQUEST_LANE_NUM,
 };
 
+class CallRequestHandler;
+
 class CallRequestHandlerService {
 public:
     CallRequestHandlerService();
     ~CallRequestHandlerService();
     void Start();
-    int32_t DialCall();
+    int32_t DialCall(bool isEcc);
     int32_t AnswerCall(int32_t callId, int32_t videoState);
     int32_t RejectCall(int32_t callId, bool isSendSms, std::string &content);
     int32_t HangUpCall(int32_t callId);
@@ -105,6 +98,11 @@ public:
     int32_t StartRtt(int32_t callId, std::u16string &msg);
     int32_t StopRtt(int32_t callId);
     int32_t JoinConference(int32_t callId, std::vector<std::string> &numberList);
+    int32_t AnswerAndHoldActive(int32_t callId, int32_t videoState);
+    int32_t AnswerAndEndActive(int32_t callId, int32_t videoState);
+    int32_t HangUpAll();
+    int32_t HangUpAllOnSlot(int32_t slotId);
+    static CallRequestLane GetRequestLane(uint32_t eventId);
     enum {
         HANDLER_DIAL_CALL_REQUEST = 0,
         HANDLER_ANSWER_CALL_REQUEST,
@@ -119,12 +117,74 @@ public:
         HANDLER_STARTRTT_REQUEST,
         HANDLER_STOPRTT_REQUEST,
         HANDLER_INVITE_TO_CONFERENCE,
+        HANDLER_ANSWER_AND_HOLD_ACTIVE_REQUEST,
+        HANDLER_ANSWER_AND_END_ACTIVE_REQUEST,
+        HANDLER_HANGUP_ALL_REQUEST,
+        HANDLER_EMERGENCY_DIAL_CALL_REQUEST,
+        HANDLER_REQUEST_NUM,
     };
 
 private:
+    template<typename... Args>
+    bool SendHandlerEvent(uint32_t eventId, Args &&...args);
+    static AppExecFwk::EventQueue::Priority GetRequestPriority(uint32_t eventId);
+    int32_t SendAnswerEvent(uint32_t eventId, int32_t callId, int32_t videoState);
+    int32_t SendHangUpAllEvent(bool isAllSlots, int32_t slotId);
+
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<CallRequestHandler> handler_;
 };
+
+/**
+ * @ClassName: CallRequestHandler
+ * @Description: inner event-handle mechanism on harmony platform, used by callcontrolmanager
+ * to handle downflowed telephone business, factually act as work thread.
+ */
+class CallRequestHandler : public AppExecFwk::EventHandler {
+public:
+    CallRequestHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
+    virtual ~CallRequestHandler();
+
+    void Init();
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    // called by the sending thread, a hold queued before the hang up of its call is dropped
+    void OnHangUpQueued(int32_t callId);
+    void OnHangUpAllQueued();
+    void OnHangUpSlotQueued(int32_t slotId);
+    void GetHoldCallPara(int32_t callId, HoldCallPara &para);
+
+private:
+    using CallRequestFunc = void (CallRequestHandler::*)(const AppExecFwk::InnerEvent::Pointer &event);
+
+    void DialCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void AcceptCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void RejectCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void HangUpCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void HoldCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void UnHoldCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void SwitchCallEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void CombineConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void SeparateConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void UpdateCallMediaModeEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void StartRttEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void StopRttEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void JoinConferenceEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void AnswerAndHoldActiveEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void AnswerAndEndActiveEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void HangUpAllEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    bool IsHoldSuperseded(const HoldCallPara &para);
+    static const CallDispatchTable<CallRequestFunc, CallRequestHandlerService::HANDLER_REQUEST_NUM> memberFuncTable_;
+    std::unique_ptr<CallRequestProcess> callRequestProcessPtr_;
+    std::atomic<uint32_t> hangUpSeq_[CALL_ID_SPACE_SIZE];
+    std::atomic<uint32_t> hangUpAllSeq_;
+};
+
+template<typename... Args>
+bool CallRequestHandlerService::SendHandlerEvent(uint32_t eventId, Args &&...args)
+{
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId, std::forward<Args>(args)...);
+    return CallPerfStatistics::SendEvent(CALL_EVENT_QUEUE_REQUEST, *handler_, event, 0, GetRequestPriority(eventId));
+}
 } // namespace Telephony
 } // namespace OHOS
 #endif // CALL_CONTROL_MANAGER_HANDLER_H
@@ -29,6 +29,9 @@ public:
     void AnswerRequest(int32_t callId, int32_t videoState);
     void RejectRequest(int32_t callId, bool isSendSms, std::string &content);
     void HangUpRequest(int32_t callId);
+    void AnswerAndHoldActiveRequest(int32_t callId, int32_t videoState);
+    void AnswerAndEndActiveRequest(int32_t callId, int32_t videoState);
+    void HangUpAllRequest(bool isAllSlots, int32_t slotId);
     void HoldRequest(int32_t callId);
     void UnHoldRequest(int32_t callId);
     void SwitchRequest(int32_t callId);
@@ -46,6 +49,8 @@ private:
     int32_t UpdateImsCallMode(int32_t callId, ImsCallMode mode);
     int32_t PackCellularCallInfo(DialParaInfo &info, CellularCallInfo &callInfo);
     bool IsFdnNumber(std::vector<std::u16string> fdnNumberList, std::string phoneNumber);
+    sptr<CallBase> GetCallToAnswer(int32_t callId);
+    bool IsCallToHangUp(const sptr<CallBase> &call, bool isAllSlots, int32_t slotId);
 };
 } // namespace Telephony
 } // namespace OHOS
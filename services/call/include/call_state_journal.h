@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_STATE_JOURNAL_H
+#define CALL_STATE_JOURNAL_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "refbase.h"
+#include "singleton.h"
+
+#include "call_manager_inner_type.h"
+
+namespace OHOS {
+namespace Telephony {
+class CallBase;
+
+// bounds the journal file and so the time a replay can take
+constexpr uint32_t CALL_JOURNAL_RECORD_NUM = 1024;
+
+enum CallJournalEventType : uint32_t {
+    CALL_JOURNAL_EVENT_CREATE = 1,
+    CALL_JOURNAL_EVENT_STATE_CHANGE,
+    CALL_JOURNAL_EVENT_CONFERENCE_CHANGE,
+    CALL_JOURNAL_EVENT_DESTROY,
+};
+
+struct CallJournalRecord {
+    uint32_t magic; // written last, a record without it was torn by a crash
+    uint32_t eventType;
+    int32_t callId;
+    int32_t accountId;
+    int32_t index;
+    int32_t callType;
+    int32_t callDirection;
+    int32_t videoState;
+    int32_t callState;
+    int32_t conferenceState;
+    int32_t isEcc;
+    char accountNumber[kMaxNumberLen + 1];
+    char bundleName[kMaxBundleNameLen + 1];
+};
+
+struct CallJournalHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordNum;
+    int64_t updateTime; // CLOCK_BOOTTIME of the last append, a smaller clock means the device rebooted
+};
+
+/**
+ * @ClassName:CallStateJournal
+ * @Description:append-only journal of the call lifecycle events, kept in a memory mapped file.
+ * The mapping is shared, so appended records survive a crash of the service process and
+ * Recover() can rebuild the call objects when the service starts again. CallStatusManager takes the
+ * rebuilt calls as reported, so the first call list of the modem ends those that are gone. The number of a call is
+ * only kept while the call is alive, it is wiped from the file when the call is destroyed.
+ */
+class CallStateJournal {
+    DECLARE_DELAYED_SINGLETON(CallStateJournal)
+public:
+    int32_t Init();
+    int32_t Recover();
+    void Clear();
+    /**
+     * the registry builds the record of a change under its shard lock and hands the lock over to Append,
+     * which takes the journal lock before releasing it. The records of a call are appended in the order
+     * of the changes, and the registry is not held while the journal is written.
+     */
+    static void FillCallCreatedRecord(CallJournalRecord &record, const sptr<CallBase> &call);
+    static void FillCallStateRecord(CallJournalRecord &record, const sptr<CallBase> &call);
+    static void FillCallDestroyedRecord(CallJournalRecord &record, int32_t callId);
+    void Append(CallJournalRecord &record, std::unique_lock<std::mutex> &orderLock);
+    void RecordConferenceStateChanged(int32_t callId, TelConferenceState state);
+    int64_t GetRecoveryTime();
+    int32_t GetRecoveredCallNum();
+
+private:
+    void AppendLocked(CallJournalRecord &record);
+    void Compact();
+    void ResetLocked();
+    void ReplayLocked(std::vector<CallJournalRecord> &callRecords);
+    void ClearCallNumberLocked(int32_t callId);
+    bool IsValidRecord(const CallJournalRecord &record);
+    sptr<CallBase> RestoreCall(const CallJournalRecord &record);
+    int64_t GetBootTime();
+
+    std::mutex mutex_;
+    CallJournalHeader *header_;
+    CallJournalRecord *records_;
+    void *mapAddr_;
+    size_t mapSize_;
+    int64_t recoveryTime_;
+    int32_t recoveredCallNum_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_STATE_JOURNAL_H
@@ -16,8 +16,11 @@
 #ifndef CALL_STATE_LISTENER_H
 #define CALL_STATE_LISTENER_H
 
+#include <map>
 #include <memory>
+#include <mutex>
 
+#include "call_observer_executor.h"
 #include "call_state_listener_base.h"
 
 namespace OHOS {
@@ -26,7 +29,8 @@ class CallStateListener {
 public:
     CallStateListener();
     virtual ~CallStateListener();
-    bool AddOneObserver(const sptr<CallStateListenerBase> &observer);
+    bool AddOneObserver(const sptr<CallStateListenerBase> &observer,
+        CallObserverPriority priority = CALL_OBSERVER_PRIORITY_CRITICAL);
     bool RemoveOneObserver(const sptr<CallStateListenerBase> &observer);
     bool RemoveAllObserver();
     void NewCallCreated(sptr<CallBase> &callObjectPtr);
@@ -37,8 +41,18 @@ public:
     void CallEventUpdated(CallEventInfo &info);
 
 private:
-    std::set<sptr<CallStateListenerBase>> listenerSet_;
+    using ObserverSet = std::map<sptr<CallStateListenerBase>, CallObserverPriority>;
+    std::shared_ptr<const ObserverSet> GetObserverSnapshot();
+    void PublishObserverSet(const std::shared_ptr<ObserverSet> &observerSet);
+    template<typename Function>
+    void Dispatch(Function function);
+
+private:
+    // immutable, replaced as a whole under mutex_ and read through atomic_load, so observers are called
+    // without any lock held and may add or remove observers themselves
+    std::shared_ptr<const ObserverSet> listenerSet_;
     std::mutex mutex_;
+    CallObserverExecutor observerExecutor_;
 };
 } // namespace Telephony
 } // namespace OHOS
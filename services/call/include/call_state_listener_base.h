@@ -36,6 +36,19 @@ public:
     virtual void IncomingCallHungUp(sptr<CallBase> &callObjectPtr, bool isSendSms, std::string content) {}
     virtual void IncomingCallActivated(sptr<CallBase> &callObjectPtr) {}
     virtual void CallEventUpdated(CallEventInfo &info) {}
+    /**
+     * same events with the attributes of the call as of the event. A best-effort observer runs after the
+     * call has moved on, so it reads these instead of the live call.
+     */
+    virtual void NewCallSnapshotCreated(sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info)
+    {
+        NewCallCreated(callObjectPtr);
+    }
+    virtual void CallSnapshotUpdated(
+        sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info, TelCallState priorState, TelCallState nextState)
+    {
+        CallStateUpdated(callObjectPtr, priorState, nextState);
+    }
 };
 } // namespace Telephony
 } // namespace OHOS
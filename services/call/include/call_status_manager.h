@@ -17,6 +17,8 @@
 #define CALL_STATUS_MANAGER_H
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "refbase.h"
 
@@ -48,6 +50,23 @@ public:
     void CallFilterCompleteResult(const CallDetailInfo &info);
 
 private:
+    struct ReportedCall {
+        CallDetailInfo info;
+        uint64_t reportSequence; // sequence of the last list report that contained the call
+    };
+    // calls of one slot by index, the key the modem uses for a call
+    using ReportedCallMap = std::unordered_map<int32_t, ReportedCall>;
+    enum CallReportChangeType {
+        CALL_REPORT_CREATED = 0,
+        CALL_REPORT_CHANGED,
+        CALL_REPORT_VANISHED,
+    };
+    struct CallReportChange {
+        CallReportChangeType type;
+        CallDetailInfo info;
+    };
+    void DiffCallsReportInfo(const CallDetailsInfo &info, std::vector<CallReportChange> &changes);
+    void SeedReportedCalls(int32_t slotId, ReportedCallMap &reportedCalls);
     void InitCallBaseEvent();
     int32_t IncomingHandle(const CallDetailInfo &info);
     int32_t DialingHandle(const CallDetailInfo &info);
@@ -58,6 +77,7 @@ private:
     int32_t DisconnectingHandle(const CallDetailInfo &info);
     int32_t DisconnectedHandle(const CallDetailInfo &info);
     sptr<CallBase> CreateNewCall(const CallDetailInfo &info, CallDirection dir);
+    sptr<CallBase> GetReportedCallObject(const CallDetailInfo &info);
     void PackParaInfo(
         DialParaInfo &paraInfo, const CallDetailInfo &info, CallDirection dir, AppExecFwk::PacMap &extras);
     int32_t UpdateCallState(sptr<CallBase> &call, TelCallState nextState);
@@ -67,7 +87,9 @@ private:
 
 private:
     CallDetailInfo callReportInfo_;
-    CallDetailsInfo callDetailsInfo_;
+    // last reported call list of every slot, updated in place by DiffCallsReportInfo
+    std::unordered_map<int32_t, ReportedCallMap> reportedCallMap_;
+    uint64_t reportSequence_;
     sptr<CallIncomingFilterManager> CallIncomingFilterManagerPtr_;
     std::map<RequestResultEventId, CallAbilityEventId> mEventIdTransferMap_;
     std::map<OttCallEventId, CallAbilityEventId> mOttEventIdTransferMap_;
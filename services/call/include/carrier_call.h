@@ -37,7 +37,9 @@ public:
     int32_t CarrierSwitchCall();
     int32_t StartDtmf(char str) override;
     int32_t StopDtmf() override;
+    int32_t SendDtmfString(const std::string &dtmfString, int32_t onLength, int32_t offLength) override;
     int32_t GetSlotId() override;
+    int32_t GetCallIndex() override;
     int32_t CarrierCombineConference();
     int32_t CarrierSeparateConference();
     int32_t IsSupportConferenceable() override;
@@ -28,6 +28,9 @@ const int16_t DIALING_CALL_NUMBER_LEN = 30;
 const int16_t CONTACT_NAME_LEN = 10;
 const int16_t FILE_PATH_MAX_LEN = 60;
 const int16_t CALL_START_ID = 0;
+// call ids are kept below CALL_ID_SPACE_SIZE, so per-call data can be indexed by call id in flat arrays
+const int16_t CALL_ID_SPACE_SIZE = 64;
+const int32_t CALL_ID_QUARANTINE_MS = 5000;
 
 namespace OHOS {
 namespace Telephony {
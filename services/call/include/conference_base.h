@@ -19,11 +19,12 @@
 #include <unistd.h>
 #include <cstdio>
 #include <cstdlib>
-#include <set>
+#include <bitset>
 #include <memory>
 #include <mutex>
 
 #include "call_manager_inner_type.h"
+#include "common_type.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -55,9 +56,13 @@ public:
     std::vector<std::u16string> GetCallIdListForConference(int32_t callId); // get participant list besides host
 
 protected:
+    // must be called with conferenceMutex_ held
+    bool IsSubCallId(int32_t callId);
+
     int32_t mainCallId_;
     ConferenceState state_;
-    std::set<int32_t> subCallIdSet_;
+    // indexed by call id, call ids are bounded by CALL_ID_SPACE_SIZE
+    std::bitset<CALL_ID_SPACE_SIZE> subCallIdSet_;
     std::mutex conferenceMutex_;
     time_t beginTime_;
     CallType conferenceType_;
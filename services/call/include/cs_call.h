@@ -18,10 +18,11 @@
 
 #include "cs_conference.h"
 #include "carrier_call.h"
+#include "call_object_pool.h"
 
 namespace OHOS {
 namespace Telephony {
-class CSCall : public CarrierCall {
+class CSCall : public CarrierCall, public PooledObject<CSCall, CALL_OBJECT_POOL_SIZE> {
 public:
     CSCall(DialParaInfo &info);
     CSCall(DialParaInfo &info, AppExecFwk::PacMap &extras);
@@ -17,12 +17,13 @@
 #define IMS_CALL_H
 
 #include "carrier_call.h"
+#include "call_object_pool.h"
 #include "net_call_base.h"
 #include "video_call_state.h"
 
 namespace OHOS {
 namespace Telephony {
-class IMSCall : public CarrierCall, public NetCallBase {
+class IMSCall : public CarrierCall, public NetCallBase, public PooledObject<IMSCall, CALL_OBJECT_POOL_SIZE> {
 public:
     IMSCall(DialParaInfo &info);
     IMSCall(DialParaInfo &info, AppExecFwk::PacMap &extras);
@@ -17,12 +17,13 @@
 #define OTT_CALL_H
 
 #include "call_base.h"
+#include "call_object_pool.h"
 #include "net_call_base.h"
 #include "ott_call_connection.h"
 
 namespace OHOS {
 namespace Telephony {
-class OTTCall : public CallBase, public NetCallBase {
+class OTTCall : public CallBase, public NetCallBase, public PooledObject<OTTCall, CALL_OBJECT_POOL_SIZE> {
 public:
     OTTCall(DialParaInfo &info);
     OTTCall(DialParaInfo &info, AppExecFwk::PacMap &extras);
@@ -38,7 +39,9 @@ public:
     bool GetEmergencyState() override;
     int32_t StartDtmf(char str) override;
     int32_t StopDtmf() override;
+    int32_t SendDtmfString(const std::string &dtmfString, int32_t onLength, int32_t offLength) override;
     int32_t GetSlotId() override;
+    int32_t GetCallIndex() override;
     int32_t CombineConference() override;
     int32_t SeparateConference() override;
     int32_t CanCombineConference() override;
@@ -21,6 +21,7 @@
 #include <mutex>
 
 #include "refbase.h"
+#include "call_object_pool.h"
 #include "net_call_base.h"
 #include "call_manager_inner_type.h"
 
@@ -49,11 +50,12 @@ public:
     sptr<VideoCallState> GetCallVideoState(ImsCallMode mode);
 
 protected:
-    sptr<NetCallBase> call_;
+    // the call owns its video states, so only a weak back reference is kept to avoid a cycle
+    wptr<NetCallBase> call_;
     VideoUpdateStatus updateStatus_;
 };
 
-class AudioOnlyState : public VideoCallState {
+class AudioOnlyState : public VideoCallState, public PooledObject<AudioOnlyState, VIDEO_STATE_POOL_SIZE> {
 public:
     AudioOnlyState(sptr<NetCallBase> callPtr);
     ~AudioOnlyState() = default;
@@ -63,7 +65,7 @@ public:
     int32_t ReceiveUpdateCallMediaModeResponse(ImsCallMode mode) override;
 };
 
-class VideoSendState : public VideoCallState {
+class VideoSendState : public VideoCallState, public PooledObject<VideoSendState, VIDEO_STATE_POOL_SIZE> {
 public:
     VideoSendState(sptr<NetCallBase> callPtr);
     ~VideoSendState() = default;
@@ -73,7 +75,7 @@ public:
     int32_t ReceiveUpdateCallMediaModeResponse(ImsCallMode mode) override;
 };
 
-class VideoReceiveState : public VideoCallState {
+class VideoReceiveState : public VideoCallState, public PooledObject<VideoReceiveState, VIDEO_STATE_POOL_SIZE> {
 public:
     VideoReceiveState(sptr<NetCallBase> callPtr);
     ~VideoReceiveState() = default;
@@ -83,7 +85,7 @@ public:
     int32_t ReceiveUpdateCallMediaModeResponse(ImsCallMode mode) override;
 };
 
-class VideoSendReceiveState : public VideoCallState {
+class VideoSendReceiveState : public VideoCallState, public PooledObject<VideoSendReceiveState, VIDEO_STATE_POOL_SIZE> {
 public:
     VideoSendReceiveState(sptr<NetCallBase> callPtr);
     ~VideoSendReceiveState() = default;
@@ -93,7 +95,7 @@ public:
     int32_t ReceiveUpdateCallMediaModeResponse(ImsCallMode mode) override;
 };
 
-class VideoPauseState : public VideoCallState {
+class VideoPauseState : public VideoCallState, public PooledObject<VideoPauseState, VIDEO_STATE_POOL_SIZE> {
 public:
     VideoPauseState(sptr<NetCallBase> callPtr);
     ~VideoPauseState() = default;
@@ -23,27 +23,59 @@
 #include "common_type.h"
 #include "cellular_call_connection.h"
 #include "audio_control_manager.h"
+#include "call_object_manager.h"
+#include "call_state_journal.h"
 
 namespace OHOS {
 namespace Telephony {
+// layout of CallBase::stateWord_, policy flags take the upper half of the word
+constexpr uint32_t RUNNING_STATE_SHIFT = 0;
+constexpr uint32_t TEL_CALL_STATE_SHIFT = 8;
+constexpr uint32_t CONFERENCE_STATE_SHIFT = 16;
+constexpr uint32_t VIDEO_STATE_SHIFT = 24;
+constexpr uint32_t POLICY_FLAG_SHIFT = 32;
+constexpr uint64_t STATE_FIELD_MASK = 0xFF;
+constexpr uint64_t POLICY_FLAG_MASK = 0xFFFFFFFF;
+
+static inline uint64_t GetStateField(uint64_t word, uint32_t shift, uint64_t mask)
+{
+    return (word >> shift) & mask;
+}
+
+static inline uint64_t SetStateField(uint64_t word, uint32_t shift, uint64_t mask, uint64_t value)
+{
+    return (word & ~(mask << shift)) | ((value & mask) << shift);
+}
+
+static uint64_t MakeStateWord(CallRunningState runningState, TelCallState telCallState,
+    TelConferenceState conferenceState, VideoStateType videoState)
+{
+    uint64_t word = 0;
+    word = SetStateField(word, RUNNING_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(runningState));
+    word = SetStateField(word, TEL_CALL_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(telCallState));
+    word = SetStateField(word, CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(conferenceState));
+    word = SetStateField(word, VIDEO_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(videoState));
+    return word;
+}
+
 CallBase::CallBase(DialParaInfo &info)
-    : callId_(info.callId), callType_(info.callType), videoState_(info.videoState), accountNumber_(info.number),
-    bundleName_(info.bundleName), callRunningState_(CallRunningState::CALL_RUNNING_STATE_CREATE),
-    conferenceState_(TelConferenceState::TEL_CONFERENCE_IDLE), startTime_(0),
-    direction_(CallDirection::CALL_DIRECTION_IN), policyFlag_(0), callState_(info.callState),
-    isSpeakerphoneOn_(false), callEndedType_(CallEndedType::UNKNOWN), callBeginTime_(0), callEndTime_(0),
-    ringBeginTime_(0), ringEndTime_(0), answerType_(CallAnswerType::CALL_ANSWER_MISSED)
+    : callId_(info.callId), callType_(info.callType), accountNumber_(info.number), bundleName_(info.bundleName),
+    stateWord_(MakeStateWord(CallRunningState::CALL_RUNNING_STATE_CREATE, info.callState,
+        TelConferenceState::TEL_CONFERENCE_IDLE, info.videoState)), startTime_(0),
+    direction_(CallDirection::CALL_DIRECTION_IN), isSpeakerphoneOn_(false), callEndedType_(CallEndedType::UNKNOWN),
+    callBeginTime_(0), callEndTime_(0), ringBeginTime_(0), ringEndTime_(0),
+    answerType_(CallAnswerType::CALL_ANSWER_MISSED), attributeVersion_(0)
 {
     (void)memset_s(&contactInfo_, sizeof(ContactInfo), 0, sizeof(ContactInfo));
 }
 
 CallBase::CallBase(DialParaInfo &info, AppExecFwk::PacMap &extras)
-    : callId_(info.callId), callType_(info.callType), videoState_(info.videoState), accountNumber_(info.number),
-    bundleName_(info.bundleName), callRunningState_(CallRunningState::CALL_RUNNING_STATE_CREATE),
-    conferenceState_(TelConferenceState::TEL_CONFERENCE_IDLE), startTime_(0),
-    direction_(CallDirection::CALL_DIRECTION_OUT), policyFlag_(0), callState_(info.callState),
-    isSpeakerphoneOn_(false), callEndedType_(CallEndedType::UNKNOWN), callBeginTime_(0), callEndTime_(0),
-    ringBeginTime_(0), ringEndTime_(0), answerType_(CallAnswerType::CALL_ANSWER_MISSED)
+    : callId_(info.callId), callType_(info.callType), accountNumber_(info.number), bundleName_(info.bundleName),
+    stateWord_(MakeStateWord(CallRunningState::CALL_RUNNING_STATE_CREATE, info.callState,
+        TelConferenceState::TEL_CONFERENCE_IDLE, info.videoState)), startTime_(0),
+    direction_(CallDirection::CALL_DIRECTION_OUT), isSpeakerphoneOn_(false), callEndedType_(CallEndedType::UNKNOWN),
+    callBeginTime_(0), callEndTime_(0), ringBeginTime_(0), ringEndTime_(0),
+    answerType_(CallAnswerType::CALL_ANSWER_MISSED), attributeVersion_(0)
 {
     (void)memset_s(&contactInfo_, sizeof(ContactInfo), 0, sizeof(ContactInfo));
 }
@@ -52,7 +84,7 @@ CallBase::~CallBase() {}
 
 int32_t CallBase::DialCallBase()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_CONNECTING;
+    SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_CONNECTING);
     TELEPHONY_LOGI("start to set audio");
     // Set audio, set hands-free
     SetAudio();
@@ -61,7 +93,7 @@ int32_t CallBase::DialCallBase()
 
 int32_t CallBase::IncomingCallBase()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_RINGING;
+    SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_RINGING);
     return TELEPHONY_SUCCESS;
 }
 
@@ -78,21 +110,24 @@ int32_t CallBase::AnswerCallBase()
 int32_t CallBase::RejectCallBase()
 {
     answerType_ = CallAnswerType::CALL_ANSWER_REJECT;
+    InvalidateCallAttributeSnapshot();
     return TELEPHONY_SUCCESS;
 }
 
 void CallBase::GetCallAttributeBaseInfo(CallAttributeInfo &info)
 {
+    uint64_t word = stateWord_.load();
     std::lock_guard<std::mutex> lock(mutex_);
     (void)memset_s(info.accountNumber, kMaxNumberLen, 0, kMaxNumberLen);
     if (memcpy_s(info.accountNumber, kMaxNumberLen, accountNumber_.c_str(), accountNumber_.length()) == 0) {
         info.speakerphoneOn = isSpeakerphoneOn_;
-        info.videoState = videoState_;
+        info.videoState = static_cast<VideoStateType>(GetStateField(word, VIDEO_STATE_SHIFT, STATE_FIELD_MASK));
         info.startTime = startTime_;
         info.callType = callType_;
         info.callId = callId_;
-        info.callState = callState_;
-        info.conferenceState = conferenceState_;
+        info.callState = static_cast<TelCallState>(GetStateField(word, TEL_CALL_STATE_SHIFT, STATE_FIELD_MASK));
+        info.conferenceState =
+            static_cast<TelConferenceState>(GetStateField(word, CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK));
         info.callBeginTime = callBeginTime_;
         info.callEndTime = callEndTime_;
         info.ringBeginTime = ringBeginTime_;
@@ -107,9 +142,30 @@ void CallBase::GetCallAttributeBaseInfo(CallAttributeInfo &info)
     }
 }
 
+std::shared_ptr<const CallAttributeInfo> CallBase::GetCallAttributeSnapshot()
+{
+    uint64_t version = attributeVersion_.load();
+    std::shared_ptr<const CallAttributeSnapshot> snapshot = std::atomic_load(&attributeSnapshot_);
+    if (snapshot == nullptr || snapshot->version != version) {
+        // a change racing with the rebuild bumps the version again, so the next caller rebuilds
+        auto newSnapshot = std::make_shared<CallAttributeSnapshot>();
+        newSnapshot->version = version;
+        (void)memset_s(&newSnapshot->info, sizeof(CallAttributeInfo), 0, sizeof(CallAttributeInfo));
+        GetCallAttributeInfo(newSnapshot->info);
+        snapshot = newSnapshot;
+        std::atomic_store(&attributeSnapshot_, snapshot);
+    }
+    return std::shared_ptr<const CallAttributeInfo>(snapshot, &snapshot->info);
+}
+
+void CallBase::InvalidateCallAttributeSnapshot()
+{
+    ++attributeVersion_;
+}
+
 int32_t CallBase::GetCallID()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    // the call id never changes after construction
     return callId_;
 }
 
@@ -120,23 +176,25 @@ CallType CallBase::GetCallType()
 
 CallRunningState CallBase::GetCallRunningState()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return callRunningState_;
+    return static_cast<CallRunningState>(GetStateField(stateWord_.load(), RUNNING_STATE_SHIFT, STATE_FIELD_MASK));
 }
 
 // transfer from external call state to callmanager local state
 int32_t CallBase::SetTelCallState(TelCallState nextState)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callState_ == nextState) {
+    // mutex_ keeps concurrent transitions and the time stamps they set in order,
+    // the state word itself is still updated with CAS since other setters do not take the lock
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool isDuplicated = false;
+    UpdateStateWord([nextState, &isDuplicated](uint64_t word) {
+        isDuplicated = GetStateField(word, TEL_CALL_STATE_SHIFT, STATE_FIELD_MASK) == static_cast<uint64_t>(nextState);
+        return isDuplicated ? word : TransferStateWord(word, nextState);
+    });
+    if (isDuplicated) {
         TELEPHONY_LOGI("Call state duplication %{public}d", nextState);
         return CALL_ERR_NOT_NEW_STATE;
     }
-    callState_ = nextState;
     switch (nextState) {
-        case TelCallState::CALL_STATUS_DIALING:
-            StateChangesToDialing();
-            break;
         case TelCallState::CALL_STATUS_INCOMING:
             StateChangesToIncoming();
             break;
@@ -146,9 +204,6 @@ int32_t CallBase::SetTelCallState(TelCallState nextState)
         case TelCallState::CALL_STATUS_ACTIVE:
             StateChangesToActive();
             break;
-        case TelCallState::CALL_STATUS_HOLDING:
-            StateChangesToHolding();
-            break;
         case TelCallState::CALL_STATUS_DISCONNECTED:
             StateChangesToDisconnected();
             break;
@@ -161,29 +216,92 @@ int32_t CallBase::SetTelCallState(TelCallState nextState)
         default:
             break;
     }
+    InvalidateCallAttributeSnapshot();
+    // the object manager takes its own lock and then reads back our states, so notify it unlocked
+    lock.unlock();
+    CallObjectManager::OnCallStateChanged(callId_);
     return TELEPHONY_SUCCESS;
 }
 
-void CallBase::StateChangesToDialing()
+void CallBase::SetCallRunningState(CallRunningState callRunningState)
+{
+    UpdateStateWord([callRunningState](uint64_t word) {
+        return SetStateField(word, RUNNING_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(callRunningState));
+    });
+    CallObjectManager::OnCallStateChanged(callId_);
+}
+
+template<typename Function>
+uint64_t CallBase::UpdateStateWord(Function func)
+{
+    uint64_t word = stateWord_.load();
+    uint64_t nextWord = func(word);
+    while (!stateWord_.compare_exchange_weak(word, nextWord)) {
+        nextWord = func(word);
+    }
+    if (nextWord != word) {
+        InvalidateCallAttributeSnapshot();
+    }
+    return nextWord;
+}
+
+uint64_t CallBase::TransferStateWord(uint64_t word, TelCallState nextState)
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_DIALING;
+    CallRunningState runningState =
+        static_cast<CallRunningState>(GetStateField(word, RUNNING_STATE_SHIFT, STATE_FIELD_MASK));
+    TelConferenceState conferenceState =
+        static_cast<TelConferenceState>(GetStateField(word, CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK));
+    switch (nextState) {
+        case TelCallState::CALL_STATUS_DIALING:
+        case TelCallState::CALL_STATUS_ALERTING:
+            runningState = CallRunningState::CALL_RUNNING_STATE_DIALING;
+            break;
+        case TelCallState::CALL_STATUS_INCOMING:
+        case TelCallState::CALL_STATUS_WAITING:
+            runningState = CallRunningState::CALL_RUNNING_STATE_RINGING;
+            break;
+        case TelCallState::CALL_STATUS_ACTIVE:
+            runningState = CallRunningState::CALL_RUNNING_STATE_ACTIVE;
+            break;
+        case TelCallState::CALL_STATUS_HOLDING:
+            runningState = CallRunningState::CALL_RUNNING_STATE_HOLD;
+            if (conferenceState == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
+                conferenceState = TelConferenceState::TEL_CONFERENCE_DISCONNECTED;
+            }
+            break;
+        case TelCallState::CALL_STATUS_DISCONNECTED:
+            runningState = CallRunningState::CALL_RUNNING_STATE_ENDED;
+            if (conferenceState == TelConferenceState::TEL_CONFERENCE_DISCONNECTING ||
+                conferenceState == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
+                conferenceState = TelConferenceState::TEL_CONFERENCE_DISCONNECTED;
+            }
+            break;
+        case TelCallState::CALL_STATUS_DISCONNECTING:
+            runningState = CallRunningState::CALL_RUNNING_STATE_ENDING;
+            if (conferenceState == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
+                conferenceState = TelConferenceState::TEL_CONFERENCE_DISCONNECTING;
+            }
+            break;
+        default:
+            break;
+    }
+    word = SetStateField(word, TEL_CALL_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(nextState));
+    word = SetStateField(word, RUNNING_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(runningState));
+    return SetStateField(word, CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(conferenceState));
 }
 
 void CallBase::StateChangesToIncoming()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_RINGING;
     ringBeginTime_ = time(nullptr);
 }
 
 void CallBase::StateChangesToWaiting()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_RINGING;
     ringBeginTime_ = time(nullptr);
 }
 
 void CallBase::StateChangesToActive()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_ACTIVE;
     if (callBeginTime_ == 0) {
         callBeginTime_ = ringEndTime_ = time(nullptr);
         startTime_ = callBeginTime_;
@@ -191,21 +309,8 @@ void CallBase::StateChangesToActive()
     }
 }
 
-void CallBase::StateChangesToHolding()
-{
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_HOLD;
-    if (conferenceState_ == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
-        conferenceState_ = TelConferenceState::TEL_CONFERENCE_DISCONNECTED;
-    }
-}
-
 void CallBase::StateChangesToDisconnected()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_ENDED;
-    if (conferenceState_ == TelConferenceState::TEL_CONFERENCE_DISCONNECTING ||
-        conferenceState_ == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
-        conferenceState_ = TelConferenceState::TEL_CONFERENCE_DISCONNECTED;
-    }
     callEndTime_ = time(nullptr);
     if (ringEndTime_ == 0) {
         ringEndTime_ = time(nullptr);
@@ -214,10 +319,6 @@ void CallBase::StateChangesToDisconnected()
 
 void CallBase::StateChangesToDisconnecting()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_ENDING;
-    if (conferenceState_ == TelConferenceState::TEL_CONFERENCE_ACTIVE) {
-        conferenceState_ = TelConferenceState::TEL_CONFERENCE_DISCONNECTING;
-    }
     if (ringEndTime_ == 0) {
         ringEndTime_ = time(nullptr);
     }
@@ -225,51 +326,53 @@ void CallBase::StateChangesToDisconnecting()
 
 void CallBase::StateChangesToAlerting()
 {
-    callRunningState_ = CallRunningState::CALL_RUNNING_STATE_DIALING;
     ringBeginTime_ = time(nullptr);
 }
 
 TelCallState CallBase::GetTelCallState()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return callState_;
+    return static_cast<TelCallState>(GetStateField(stateWord_.load(), TEL_CALL_STATE_SHIFT, STATE_FIELD_MASK));
 }
 
 void CallBase::SetTelConferenceState(TelConferenceState state)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    conferenceState_ = state;
+    UpdateStateWord([state](uint64_t word) {
+        return SetStateField(word, CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(state));
+    });
+    DelayedSingleton<CallStateJournal>::GetInstance()->RecordConferenceStateChanged(callId_, state);
     TELEPHONY_LOGI("SetTelConferenceState, state:%{public}d", state);
 }
 
 TelConferenceState CallBase::GetTelConferenceState()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return conferenceState_;
+    return static_cast<TelConferenceState>(
+        GetStateField(stateWord_.load(), CONFERENCE_STATE_SHIFT, STATE_FIELD_MASK));
 }
 
 VideoStateType CallBase::GetVideoStateType()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return videoState_;
+    return static_cast<VideoStateType>(GetStateField(stateWord_.load(), VIDEO_STATE_SHIFT, STATE_FIELD_MASK));
 }
 
 void CallBase::SetVideoStateType(VideoStateType mediaType)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    videoState_ = mediaType;
+    UpdateStateWord([mediaType](uint64_t word) {
+        return SetStateField(word, VIDEO_STATE_SHIFT, STATE_FIELD_MASK, static_cast<uint64_t>(mediaType));
+    });
 }
 
 void CallBase::SetPolicyFlag(PolicyFlag flag)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    policyFlag_ |= flag;
+    if ((static_cast<uint64_t>(flag) & ~POLICY_FLAG_MASK) != 0) {
+        TELEPHONY_LOGE("policy flag out of range");
+        return;
+    }
+    stateWord_.fetch_or(static_cast<uint64_t>(flag) << POLICY_FLAG_SHIFT);
 }
 
 uint64_t CallBase::GetPolicyFlag()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return policyFlag_;
+    return GetStateField(stateWord_.load(), POLICY_FLAG_SHIFT, POLICY_FLAG_MASK);
 }
 
 bool CallBase::GetCallerInfo(ContactInfo &info)
@@ -328,7 +431,7 @@ bool CallBase::IsSpeakerphoneEnabled()
 
 bool CallBase::IsCurrentRinging()
 {
-    return (callRunningState_ == CallRunningState::CALL_RUNNING_STATE_RINGING) ? true : false;
+    return (GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_RINGING) ? true : false;
 }
 
 std::string CallBase::GetAccountNumber()
@@ -339,6 +442,7 @@ std::string CallBase::GetAccountNumber()
 int32_t CallBase::SetSpeakerphoneOn(bool speakerphoneOn)
 {
     isSpeakerphoneOn_ = speakerphoneOn;
+    InvalidateCallAttributeSnapshot();
     return TELEPHONY_SUCCESS;
 }
 
@@ -349,8 +453,9 @@ bool CallBase::IsSpeakerphoneOn()
 
 bool CallBase::IsAliveState()
 {
-    return !(callState_ == TelCallState::CALL_STATUS_IDLE || callState_ == TelCallState::CALL_STATUS_DISCONNECTED ||
-        callState_ == TelCallState::CALL_STATUS_DISCONNECTING);
+    TelCallState callState = GetTelCallState();
+    return !(callState == TelCallState::CALL_STATUS_IDLE || callState == TelCallState::CALL_STATUS_DISCONNECTED ||
+        callState == TelCallState::CALL_STATUS_DISCONNECTING);
 }
 } // namespace Telephony
 } // namespace OHOS
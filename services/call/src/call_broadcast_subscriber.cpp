@@ -22,11 +22,16 @@
 
 namespace OHOS {
 namespace Telephony {
+constexpr CallDispatchTable<CallBroadcastSubscriber::broadcastSubscriberFunc,
+    CallBroadcastSubscriber::BROADCAST_EVENT_NUM>
+    CallBroadcastSubscriber::memberFuncTable_({
+        { UNKNOWN_BROADCAST_EVENT, &CallBroadcastSubscriber::UnknownBroadcast },
+        { SIM_STATE_BROADCAST_EVENT, &CallBroadcastSubscriber::SimStateBroadcast },
+    });
+
 CallBroadcastSubscriber::CallBroadcastSubscriber(const OHOS::EventFwk::CommonEventSubscribeInfo &subscriberInfo)
     : CommonEventSubscriber(subscriberInfo)
 {
-    memberFuncMap_[UNKNOWN_BROADCAST_EVENT] = &CallBroadcastSubscriber::UnknownBroadcast;
-    memberFuncMap_[SIM_STATE_BROADCAST_EVENT] = &CallBroadcastSubscriber::SimStateBroadcast;
 }
 
 void CallBroadcastSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &data)
@@ -40,12 +45,9 @@ void CallBroadcastSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &da
     } else {
         code = UNKNOWN_BROADCAST_EVENT;
     }
-    auto itFunc = memberFuncMap_.find(code);
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
-            return (this->*memberFunc)(data);
-        }
+    auto memberFunc = memberFuncTable_.Find(code);
+    if (memberFunc != nullptr) {
+        return (this->*memberFunc)(data);
     }
 }
 
@@ -121,7 +121,7 @@ int32_t CallControlManager::DialCall(std::u16string &number, AppExecFwk::PacMap
         TELEPHONY_LOGE("callRequestHandlerServicePtr_ is nullptr!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    ret = callRequestHandlerServicePtr_->DialCall();
+    ret = callRequestHandlerServicePtr_->DialCall(isEcc);
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("DialCall failed!");
         return ret;
@@ -187,6 +187,82 @@ int32_t CallControlManager::HangUpCall(int32_t callId)
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallControlManager::AnswerAndHoldActiveCall(int32_t callId, int32_t videoState)
+{
+    int32_t ret = AnswerAndHoldActivePolicy(callId, videoState);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerAndHoldActivePolicy failed!");
+        return ret;
+    }
+    if (callRequestHandlerServicePtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestHandlerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    ret = callRequestHandlerServicePtr_->AnswerAndHoldActive(callId, videoState);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerAndHoldActive failed!");
+        return ret;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallControlManager::AnswerAndEndActiveCall(int32_t callId, int32_t videoState)
+{
+    int32_t ret = AnswerCallPolicy(callId, videoState);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerCallPolicy failed!");
+        return ret;
+    }
+    if (callRequestHandlerServicePtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestHandlerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    ret = callRequestHandlerServicePtr_->AnswerAndEndActive(callId, videoState);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AnswerAndEndActive failed!");
+        return ret;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallControlManager::HangUpAllCall()
+{
+    if (callRequestHandlerServicePtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestHandlerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    int32_t ret = HangUpAllPolicy();
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAllPolicy failed!");
+        return ret;
+    }
+    ret = callRequestHandlerServicePtr_->HangUpAll();
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAll failed!");
+        return ret;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallControlManager::HangUpAllCallOnSlot(int32_t slotId)
+{
+    if (callRequestHandlerServicePtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestHandlerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    int32_t ret = HangUpAllOnSlotPolicy(slotId);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAllOnSlotPolicy failed!");
+        return ret;
+    }
+    ret = callRequestHandlerServicePtr_->HangUpAllOnSlot(slotId);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("HangUpAllOnSlot failed!");
+        return ret;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallControlManager::GetCallState()
 {
     CallStateToApp callState = CallStateToApp::CALL_STATE_UNKNOWN;
@@ -385,6 +461,32 @@ int32_t CallControlManager::StopDtmf(int32_t callId)
     return ret;
 }
 
+int32_t CallControlManager::SendDtmfString(
+    int32_t callId, const std::string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    if (dtmfString.length() > DTMF_STRING_MAX_LEN) {
+        return CALL_ERR_DTMF_EXCEED_LIMIT;
+    }
+    sptr<CallBase> call = GetOneCallObject(callId);
+    if (call == nullptr) {
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    if (!call->IsAliveState()) {
+        return CALL_ERR_CALL_STATE_MISMATCH_OPERATION;
+    }
+    onLength = (onLength == 0) ? DTMF_DEFAULT_ON_LENGTH : onLength;
+    offLength = (offLength == 0) ? DTMF_DEFAULT_OFF_LENGTH : offLength;
+    if (onLength < DTMF_MIN_LENGTH || onLength > DTMF_MAX_LENGTH || offLength < DTMF_MIN_LENGTH ||
+        offLength > DTMF_MAX_LENGTH) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    int32_t ret = call->SendDtmfString(dtmfString, onLength, offLength);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("SendDtmfString failed, return:%{public}d", ret);
+    }
+    return ret;
+}
+
 int32_t CallControlManager::GetCallWaiting(int32_t slotId)
 {
     int32_t ret = CallPolicy::GetCallWaitingPolicy(slotId);
@@ -580,6 +682,11 @@ std::vector<std::u16string> CallControlManager::GetCallIdListForConference(int32
     return call->GetCallIdListForConference();
 }
 
+int32_t CallControlManager::GetCallSnapshot(std::vector<CallSnapshotInfo> &callList)
+{
+    return GetCallSnapshotInfoList(callList);
+}
+
 int32_t CallControlManager::GetImsConfig(int32_t slotId, ImsConfigItem item)
 {
     int32_t ret = CallPolicy::GetImsConfigPolicy(slotId);
@@ -905,14 +1012,18 @@ void CallControlManager::CallStateObserve()
         TELEPHONY_LOGE("CallStateReportProxy is nullptr!");
         return;
     }
-    callStateListenerPtr_->AddOneObserver(DelayedSingleton<CallAbilityReportProxy>::GetInstance().get());
-    callStateListenerPtr_->AddOneObserver(callStateReportPtr.release());
-    callStateListenerPtr_->AddOneObserver(DelayedSingleton<AudioControlManager>::GetInstance().get());
-    callStateListenerPtr_->AddOneObserver(hangUpSmsPtr.release());
-    callStateListenerPtr_->AddOneObserver(callStateBroadcastPtr.release());
-    callStateListenerPtr_->AddOneObserver(missedCallNotification_.release());
-    callStateListenerPtr_->AddOneObserver(incomingCallWakeup_.release());
-    callStateListenerPtr_->AddOneObserver(DelayedSingleton<CallRecordsManager>::GetInstance().get());
+    // audio, the UI callback and the screen wake up decide the time to ring, the others are best-effort
+    callStateListenerPtr_->AddOneObserver(
+        DelayedSingleton<CallAbilityReportProxy>::GetInstance().get(), CALL_OBSERVER_PRIORITY_CRITICAL);
+    callStateListenerPtr_->AddOneObserver(
+        DelayedSingleton<AudioControlManager>::GetInstance().get(), CALL_OBSERVER_PRIORITY_CRITICAL);
+    callStateListenerPtr_->AddOneObserver(incomingCallWakeup_.release(), CALL_OBSERVER_PRIORITY_CRITICAL);
+    callStateListenerPtr_->AddOneObserver(callStateReportPtr.release(), CALL_OBSERVER_PRIORITY_BEST_EFFORT);
+    callStateListenerPtr_->AddOneObserver(hangUpSmsPtr.release(), CALL_OBSERVER_PRIORITY_BEST_EFFORT);
+    callStateListenerPtr_->AddOneObserver(callStateBroadcastPtr.release(), CALL_OBSERVER_PRIORITY_BEST_EFFORT);
+    callStateListenerPtr_->AddOneObserver(missedCallNotification_.release(), CALL_OBSERVER_PRIORITY_BEST_EFFORT);
+    callStateListenerPtr_->AddOneObserver(
+        DelayedSingleton<CallRecordsManager>::GetInstance().get(), CALL_OBSERVER_PRIORITY_BEST_EFFORT);
 }
 
 int32_t CallControlManager::NumberLegalityCheck(std::string &number)
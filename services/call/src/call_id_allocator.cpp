@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_id_allocator.h"
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+CallIdAllocator::CallIdAllocator() : lastCallId_(CALL_START_ID)
+{
+    inUse_.reset();
+    released_.reset();
+}
+
+int32_t CallIdAllocator::Allocate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    int32_t oldestCallId = ERR_ID;
+    int32_t callId = lastCallId_;
+    // walk the id space round robin starting after the last handed out id, so freed ids are reused as late as possible
+    for (int32_t i = CALL_START_ID + 1; i < CALL_ID_SPACE_SIZE; ++i) {
+        callId = (callId + 1 < CALL_ID_SPACE_SIZE) ? (callId + 1) : (CALL_START_ID + 1);
+        if (inUse_.test(callId)) {
+            continue;
+        }
+        if (!IsInQuarantine(callId, now)) {
+            oldestCallId = callId;
+            break;
+        }
+        if (oldestCallId == ERR_ID || releaseTime_[callId] < releaseTime_[oldestCallId]) {
+            oldestCallId = callId;
+        }
+    }
+    if (oldestCallId == ERR_ID) {
+        TELEPHONY_LOGE("all %{public}d call ids are in use", CALL_ID_SPACE_SIZE - CALL_START_ID - 1);
+        return ERR_ID;
+    }
+    if (IsInQuarantine(oldestCallId, now)) {
+        TELEPHONY_LOGW("callId:%{public}d is reused before its quarantine ends", oldestCallId);
+    }
+    inUse_.set(oldestCallId);
+    lastCallId_ = oldestCallId;
+    return oldestCallId;
+}
+
+bool CallIdAllocator::Reserve(int32_t callId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!IsValidCallId(callId) || inUse_.test(callId)) {
+        TELEPHONY_LOGE("callId:%{public}d can not be reserved", callId);
+        return false;
+    }
+    inUse_.set(callId);
+    return true;
+}
+
+void CallIdAllocator::Release(int32_t callId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!IsValidCallId(callId) || !inUse_.test(callId)) {
+        TELEPHONY_LOGW("callId:%{public}d is not allocated", callId);
+        return;
+    }
+    inUse_.reset(callId);
+    released_.set(callId);
+    releaseTime_[callId] = std::chrono::steady_clock::now();
+}
+
+bool CallIdAllocator::IsValidCallId(int32_t callId)
+{
+    return callId > CALL_START_ID && callId < CALL_ID_SPACE_SIZE;
+}
+
+bool CallIdAllocator::IsInQuarantine(int32_t callId, std::chrono::steady_clock::time_point now)
+{
+    // a call id that has never been released is not in quarantine
+    return released_.test(callId) && (now - releaseTime_[callId] < std::chrono::milliseconds(CALL_ID_QUARANTINE_MS));
+}
+} // namespace Telephony
+} // namespace OHOS
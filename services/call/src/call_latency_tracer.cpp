@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "call_latency_tracer.h"
+
+#include <chrono>
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int64_t NANOSECONDS_PER_MICROSECOND = 1000;
+constexpr uint32_t UINT64_BITS = 64;
+constexpr uint32_t PERCENT_MEDIAN = 50;
+constexpr uint32_t PERCENT_TAIL = 99;
+constexpr uint32_t PERCENT_ALL = 100;
+
+const char *const CALL_LATENCY_STAGE_NAMES[CALL_LATENCY_STAGE_NUM] = {
+    "report_queue",
+    "report_handle",
+    "report_observer",
+    "report_ipc",
+    "report_total",
+    "dial_queue",
+    "dial_handle",
+    "dial_ipc",
+    "dial_total",
+};
+
+thread_local int64_t g_traceBeginTime = 0;
+thread_local int64_t g_traceStageTime = 0;
+} // namespace
+
+CallLatencyHistogram CallLatencyTracer::histograms_[CALL_LATENCY_STAGE_NUM];
+
+void CallLatencyHistogram::Record(int64_t latencyUs)
+{
+    buckets_[GetBucketIndex(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    int64_t max = max_.load(std::memory_order_relaxed);
+    while (latencyUs > max && !max_.compare_exchange_weak(max, latencyUs, std::memory_order_relaxed)) {}
+}
+
+uint64_t CallLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+int64_t CallLatencyHistogram::GetPercentile(uint32_t percent) const
+{
+    uint64_t count = GetCount();
+    if (count == 0) {
+        return 0;
+    }
+    // the buckets are read one by one while others record, so the rank is clamped to what was seen
+    uint64_t rank = (count * percent + PERCENT_ALL - 1) / PERCENT_ALL;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < CALL_LATENCY_BUCKET_NUM - 1; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            // the upper bound of the bucket, never above the largest latency recorded
+            int64_t bound = GetBucketUpperBound(i);
+            int64_t max = GetMax();
+            return bound < max ? bound : max;
+        }
+    }
+    return GetMax();
+}
+
+int64_t CallLatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+void CallLatencyHistogram::Merge(const CallLatencyHistogram &other)
+{
+    for (uint32_t i = 0; i < CALL_LATENCY_BUCKET_NUM; ++i) {
+        buckets_[i].fetch_add(other.buckets_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    count_.fetch_add(other.GetCount(), std::memory_order_relaxed);
+    int64_t otherMax = other.GetMax();
+    int64_t max = max_.load(std::memory_order_relaxed);
+    while (otherMax > max && !max_.compare_exchange_weak(max, otherMax, std::memory_order_relaxed)) {}
+}
+
+uint32_t CallLatencyHistogram::GetBucketIndex(int64_t latencyUs)
+{
+    if (latencyUs < static_cast<int64_t>(CALL_LATENCY_SUB_BUCKET_NUM)) {
+        return latencyUs < 0 ? 0 : static_cast<uint32_t>(latencyUs);
+    }
+    uint64_t value = static_cast<uint64_t>(latencyUs);
+    uint32_t exponent = UINT64_BITS - 1 - static_cast<uint32_t>(__builtin_clzll(value));
+    if (exponent > CALL_LATENCY_MAX_EXPONENT) {
+        return CALL_LATENCY_BUCKET_NUM - 1;
+    }
+    // the bits right below the leading one pick the bucket within its power of two
+    uint32_t subIndex =
+        static_cast<uint32_t>(value >> (exponent - CALL_LATENCY_SUB_BUCKET_BITS)) - CALL_LATENCY_SUB_BUCKET_NUM;
+    return (exponent - CALL_LATENCY_SUB_BUCKET_BITS + 1) * CALL_LATENCY_SUB_BUCKET_NUM + subIndex;
+}
+
+// the largest latency the bucket counts, buckets below CALL_LATENCY_SUB_BUCKET_NUM hold a single value
+int64_t CallLatencyHistogram::GetBucketUpperBound(uint32_t bucketIndex)
+{
+    uint32_t block = bucketIndex / CALL_LATENCY_SUB_BUCKET_NUM;
+    uint32_t subIndex = bucketIndex % CALL_LATENCY_SUB_BUCKET_NUM;
+    if (block == 0) {
+        return static_cast<int64_t>(subIndex);
+    }
+    int64_t width = static_cast<int64_t>(1) << (block - 1);
+    return (static_cast<int64_t>(CALL_LATENCY_SUB_BUCKET_NUM + subIndex) << (block - 1)) + width - 1;
+}
+
+void CallLatencyHistogram::Dump(std::string &result) const
+{
+    result.append(" count:")
+        .append(std::to_string(GetCount()))
+        .append(" p50:")
+        .append(std::to_string(GetPercentile(PERCENT_MEDIAN)))
+        .append(" p99:")
+        .append(std::to_string(GetPercentile(PERCENT_TAIL)))
+        .append(" max:")
+        .append(std::to_string(GetMax()))
+        .append("\n");
+}
+
+int64_t CallLatencyTracer::GetTraceTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t CallLatencyTracer::GetElapsedTime(int64_t beginTime)
+{
+    return (GetTraceTime() - beginTime) / NANOSECONDS_PER_MICROSECOND;
+}
+
+int64_t CallLatencyTracer::GetTraceBeginTime()
+{
+    return g_traceBeginTime;
+}
+
+void CallLatencyTracer::MarkStage(CallLatencyStage stage)
+{
+    if (g_traceBeginTime == 0 || stage >= CALL_LATENCY_STAGE_NUM) {
+        return;
+    }
+    int64_t now = GetTraceTime();
+    histograms_[stage].Record((now - g_traceStageTime) / NANOSECONDS_PER_MICROSECOND);
+    g_traceStageTime = now;
+}
+
+void CallLatencyTracer::EndTrace(CallLatencyStage stage, CallLatencyStage totalStage)
+{
+    if (g_traceBeginTime == 0 || totalStage >= CALL_LATENCY_STAGE_NUM) {
+        return;
+    }
+    MarkStage(stage);
+    histograms_[totalStage].Record((g_traceStageTime - g_traceBeginTime) / NANOSECONDS_PER_MICROSECOND);
+}
+
+void CallLatencyTracer::Dump(std::string &result)
+{
+    result.append("Ohos call_manager call event latency(microseconds):\n");
+    for (uint32_t i = 0; i < CALL_LATENCY_STAGE_NUM; ++i) {
+        result.append("  ").append(CALL_LATENCY_STAGE_NAMES[i]);
+        histograms_[i].Dump(result);
+    }
+}
+
+CallLatencyTraceScope::CallLatencyTraceScope(int64_t beginTime)
+    : priorBeginTime_(g_traceBeginTime), priorStageTime_(g_traceStageTime)
+{
+    g_traceBeginTime = beginTime;
+    g_traceStageTime = beginTime;
+}
+
+CallLatencyTraceScope::~CallLatencyTraceScope()
+{
+    g_traceBeginTime = priorBeginTime_;
+    g_traceStageTime = priorStageTime_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -15,27 +15,34 @@
 
 #include "call_object_manager.h"
 
+#include <algorithm>
+
 #include "call_manager_errors.h"
 #include "telephony_log_wrapper.h"
 
+#include "call_state_journal.h"
+
 namespace OHOS {
 namespace Telephony {
-std::list<sptr<CallBase>> CallObjectManager::callObjectPtrList_;
-std::mutex CallObjectManager::listMutex_;
-int32_t CallObjectManager::callId_ = CALL_START_ID;
+constexpr uint32_t SLOT_INDEX_KEY_SHIFT = 32;
+constexpr int32_t NO_SLOT_SHARD_INDEX = CALL_SHARD_NUM - 1;
+
+CallObjectManager::CallShard CallObjectManager::callShards_[CALL_SHARD_NUM];
+std::atomic<int32_t> CallObjectManager::callIdShardIndex_[CALL_ID_SPACE_SIZE];
+std::atomic<uint64_t> CallObjectManager::callSequence_(0);
+std::atomic<int32_t> CallObjectManager::callCount_(0);
+std::atomic<int32_t> CallObjectManager::runningStateCount_[CALL_RUNNING_STATE_NUM];
+std::atomic<int32_t> CallObjectManager::telCallStateCount_[TEL_CALL_STATE_NUM];
+CallIdAllocator CallObjectManager::callIdAllocator_;
 
 CallObjectManager::CallObjectManager()
 {
-    callObjectPtrList_.clear();
+    ClearCallShards();
 }
 
 CallObjectManager::~CallObjectManager()
 {
-    std::list<sptr<CallBase>>::iterator it = callObjectPtrList_.begin();
-    while (it != callObjectPtrList_.end()) {
-        (*it) = nullptr;
-        callObjectPtrList_.erase(it++);
-    }
+    ClearCallShards();
 }
 
 int32_t CallObjectManager::AddOneCallObject(sptr<CallBase> &call)
@@ -43,31 +50,50 @@ int32_t CallObjectManager::AddOneCallObject(sptr<CallBase> &call)
     if (call == nullptr) {
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallID() == call->GetCallID()) {
-            TELEPHONY_LOGE("this call has existed yet!");
-            return CALL_ERR_PHONE_CALL_ALREADY_EXISTS;
-        }
+    int32_t callId = call->GetCallID();
+    if (callId <= CALL_START_ID || callId >= CALL_ID_SPACE_SIZE) {
+        TELEPHONY_LOGE("callId is invalid:%{public}d", callId);
+        return CALL_ERR_INVALID_CALLID;
+    }
+    // the record takes the lock of the call, which is never taken under a shard lock
+    CallJournalRecord journalRecord;
+    CallStateJournal::FillCallCreatedRecord(journalRecord, call);
+    int32_t shardIndex = GetCallShardIndex(call);
+    CallShard &shard = callShards_[shardIndex];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    // the id slot is claimed atomically, a call with the same id added to another shard can not claim it too
+    int32_t unclaimed = 0;
+    if (!callIdShardIndex_[callId].compare_exchange_strong(unclaimed, shardIndex + 1)) {
+        TELEPHONY_LOGE("this call has existed yet!");
+        return CALL_ERR_PHONE_CALL_ALREADY_EXISTS;
     }
-    callObjectPtrList_.emplace_back(call);
-    TELEPHONY_LOGI("AddOneCallObject success! callId:%{public}d,call list size:%{public}zu", call->GetCallID(),
-        callObjectPtrList_.size());
+    CallEntry entry = { ++callSequence_, call };
+    shard.callList.emplace_back(entry);
+    AddCallIndexes(shard, entry);
+    PublishCallSnapshot(shard);
+    DelayedSingleton<CallStateJournal>::GetInstance()->Append(journalRecord, lock);
+    TELEPHONY_LOGI("AddOneCallObject success! callId:%{public}d,call list size:%{public}d", callId, callCount_.load());
     return TELEPHONY_SUCCESS;
 }
 
 int32_t CallObjectManager::DeleteOneCallObject(int32_t callId)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallID() == callId) {
-            callObjectPtrList_.erase(it);
-            TELEPHONY_LOGI("DeleteOneCallObject success! call list size:%{public}zu", callObjectPtrList_.size());
-            break;
-        }
+    int32_t shardIndex = GetCallIdShardIndex(callId);
+    if (shardIndex == ERR_ID) {
+        return TELEPHONY_SUCCESS;
+    }
+    CallShard &shard = callShards_[shardIndex];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto iter = shard.callIdMap.find(callId);
+    if (iter == shard.callIdMap.end()) {
+        return TELEPHONY_SUCCESS;
     }
+    sptr<CallBase> call = iter->second.call;
+    DeleteCallIndexes(shard, call);
+    shard.callList.remove_if([&call](const CallEntry &entry) { return entry.call == call; });
+    PublishCallSnapshot(shard);
+    RecordCallDestroyed(callId, lock);
+    TELEPHONY_LOGI("DeleteOneCallObject success! call list size:%{public}d", callCount_.load());
     return TELEPHONY_SUCCESS;
 }
 
@@ -77,23 +103,35 @@ void CallObjectManager::DeleteOneCallObject(sptr<CallBase> &call)
         TELEPHONY_LOGE("call is null!");
         return;
     }
-    std::lock_guard<std::mutex> lock(listMutex_);
-    callObjectPtrList_.remove(call);
-    TELEPHONY_LOGI("DeleteOneCallObject success! callList size:%{public}zu", callObjectPtrList_.size());
+    CallShard &shard = callShards_[GetCallShardIndex(call)];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    int32_t callId = call->GetCallID();
+    auto iter = shard.callIdMap.find(callId);
+    bool isIndexed = (iter != shard.callIdMap.end() && iter->second.call == call);
+    if (isIndexed) {
+        DeleteCallIndexes(shard, call);
+    }
+    shard.callList.remove_if([&call](const CallEntry &entry) { return entry.call == call; });
+    PublishCallSnapshot(shard);
+    if (isIndexed) {
+        RecordCallDestroyed(callId, lock);
+    }
+    TELEPHONY_LOGI("DeleteOneCallObject success! callList size:%{public}d", callCount_.load());
 }
 
 sptr<CallBase> CallObjectManager::GetOneCallObject(int32_t callId)
 {
-    sptr<CallBase> retPtr = nullptr;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = CallObjectManager::callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallID() == callId) {
-            retPtr = *it;
-            break;
-        }
+    int32_t shardIndex = GetCallIdShardIndex(callId);
+    if (shardIndex == ERR_ID) {
+        return nullptr;
     }
-    return retPtr;
+    CallShard &shard = callShards_[shardIndex];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.callIdMap.find(callId);
+    if (iter == shard.callIdMap.end()) {
+        return nullptr;
+    }
+    return iter->second.call;
 }
 
 sptr<CallBase> CallObjectManager::GetOneCallObject(std::string &phoneNumber)
@@ -102,129 +140,128 @@ sptr<CallBase> CallObjectManager::GetOneCallObject(std::string &phoneNumber)
         TELEPHONY_LOGE("call is null!");
         return nullptr;
     }
-    sptr<CallBase> retPtr = nullptr;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetAccountNumber() == phoneNumber) {
-            TELEPHONY_LOGI("GetOneCallObject success!");
-            retPtr = *it;
-            break;
+    std::string number = NormalizeNumber(phoneNumber);
+    // the same number may be in a call on both slots, the one added first wins as with a single list
+    CallEntry found = { 0, nullptr };
+    for (CallShard &shard : callShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.callNumberMap.find(number);
+        if (iter == shard.callNumberMap.end() || iter->second.empty()) {
+            continue;
         }
+        if (found.call == nullptr || iter->second.front().sequence < found.sequence) {
+            found = iter->second.front();
+        }
+    }
+    if (found.call == nullptr) {
+        return nullptr;
+    }
+    TELEPHONY_LOGI("GetOneCallObject success!");
+    return found.call;
+}
+
+sptr<CallBase> CallObjectManager::GetOneCallObject(int32_t slotId, int32_t index)
+{
+    CallShard &shard = callShards_[GetSlotShardIndex(slotId)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.callSlotIndexMap.find(GetSlotIndexKey(slotId, index));
+    if (iter == shard.callSlotIndexMap.end()) {
+        return nullptr;
     }
-    return retPtr;
+    return iter->second;
 }
 
 int32_t CallObjectManager::HasNewCall()
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_CREATE ||
-            (*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_CONNECTING ||
-            (*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_DIALING) {
-            TELEPHONY_LOGE("there is already a new call[callId:%{public}d,state:%{public}d], please redial later",
-                (*it)->GetCallID(), (*it)->GetCallRunningState());
-            return CALL_ERR_DIAL_IS_BUSY;
-        }
+    int32_t createCount = GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_CREATE);
+    int32_t connectingCount = GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_CONNECTING);
+    int32_t dialingCount = GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_DIALING);
+    if (createCount > 0 || connectingCount > 0 || dialingCount > 0) {
+        TELEPHONY_LOGE("there is already a new call[create:%{public}d,connecting:%{public}d,dialing:%{public}d], "
+            "please redial later", createCount, connectingCount, dialingCount);
+        return CALL_ERR_DIAL_IS_BUSY;
     }
     return TELEPHONY_SUCCESS;
 }
 
 bool CallObjectManager::IsNewCallAllowedCreate()
 {
-    bool ret = true;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_CREATE ||
-            (*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_CONNECTING ||
-            (*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_DIALING ||
-            (*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_RINGING) {
-            TELEPHONY_LOGE("there is already a new call, please redial later");
-            ret = false;
-            break;
-        }
+    if (GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_CREATE) > 0 ||
+        GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_CONNECTING) > 0 ||
+        GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_DIALING) > 0 ||
+        GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_RINGING) > 0) {
+        TELEPHONY_LOGE("there is already a new call, please redial later");
+        return false;
     }
-    return ret;
+    return true;
 }
 
 int32_t CallObjectManager::GetCarrierCallList(std::list<int32_t> &list)
 {
     list.clear();
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallType() == CallType::TYPE_CS || (*it)->GetCallType() == CallType::TYPE_IMS) {
-            list.emplace_back((*it)->GetCallID());
+    std::vector<CallEntry> entries;
+    GetAllCallEntries(entries);
+    for (const CallEntry &entry : entries) {
+        if (entry.call->GetCallType() == CallType::TYPE_CS || entry.call->GetCallType() == CallType::TYPE_IMS) {
+            list.emplace_back(entry.call->GetCallID());
         }
     }
     return TELEPHONY_SUCCESS;
 }
 
-bool CallObjectManager::HasRingingMaximum()
+int32_t CallObjectManager::GetAllCallList(std::list<sptr<CallBase>> &list)
 {
-    int32_t ringingCount = 0;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        // Count the number of calls in the ringing state
-        if ((*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_RINGING) {
-            ringingCount++;
-        }
-    }
-    if (ringingCount >= RINGING_CALL_NUMBER_LEN) {
-        return true;
+    list.clear();
+    std::vector<CallEntry> entries;
+    GetAllCallEntries(entries);
+    for (const CallEntry &entry : entries) {
+        list.emplace_back(entry.call);
     }
-    return false;
+    return TELEPHONY_SUCCESS;
+}
+
+bool CallObjectManager::HasRingingMaximum()
+{
+    // Count the number of calls in the ringing state
+    return GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_RINGING) >= RINGING_CALL_NUMBER_LEN;
 }
 
 bool CallObjectManager::HasDialingMaximum()
 {
-    int32_t dialingCount = 0;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        // Count the number of calls in the active state
-        if ((*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_ACTIVE) {
-            dialingCount++;
-        }
-    }
-    if (dialingCount >= DIALING_CALL_NUMBER_LEN) {
-        return true;
-    }
-    return false;
+    // Count the number of calls in the active state
+    return GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_ACTIVE) >= DIALING_CALL_NUMBER_LEN;
 }
 
 bool CallObjectManager::HasEmergencyCall()
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetEmergencyState()) {
-            return true;
-        }
-    }
-    return false;
+    return FindCall([](const sptr<CallBase> &call) { return call->GetEmergencyState(); }, false) != nullptr;
 }
 
 int32_t CallObjectManager::GetNewCallId()
 {
-    int32_t ret = 0;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    ret = ++callId_;
-    return ret;
+    return callIdAllocator_.Allocate();
+}
+
+bool CallObjectManager::ReserveCallId(int32_t callId)
+{
+    return callIdAllocator_.Reserve(callId);
+}
+
+void CallObjectManager::RecycleCallId(int32_t callId)
+{
+    callIdAllocator_.Release(callId);
+}
+
+int32_t CallObjectManager::GetCallIdSpaceSize()
+{
+    return CALL_ID_SPACE_SIZE;
 }
 
 bool CallObjectManager::IsCallExist(int32_t callId)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallID() == callId) {
-            TELEPHONY_LOGW("the call is exist.");
-            return true;
-        }
+    if (GetCallIdShardIndex(callId) != ERR_ID) {
+        TELEPHONY_LOGW("the call is exist.");
+        return true;
     }
     return false;
 }
@@ -234,10 +271,11 @@ bool CallObjectManager::IsCallExist(std::string &phoneNumber)
     if (phoneNumber.empty()) {
         return false;
     }
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetAccountNumber() == phoneNumber) {
+    std::string number = NormalizeNumber(phoneNumber);
+    for (CallShard &shard : callShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.callNumberMap.find(number);
+        if (iter != shard.callNumberMap.end() && !iter->second.empty()) {
             return true;
         }
     }
@@ -247,63 +285,53 @@ bool CallObjectManager::IsCallExist(std::string &phoneNumber)
 
 bool CallObjectManager::HasCallExist()
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    if (callObjectPtrList_.empty()) {
-        TELEPHONY_LOGI("call list size:%{public}zu", callObjectPtrList_.size());
+    if (callCount_.load() <= 0) {
+        TELEPHONY_LOGI("call list size:0");
         return false;
     }
     return true;
 }
 
+int32_t CallObjectManager::GetCallObjectNum()
+{
+    return callCount_.load();
+}
+
 bool CallObjectManager::HasRingingCall()
 {
-    bool ret = false;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        // Count the number of calls in the ringing state
-        if ((*it)->GetCallRunningState() == CallRunningState::CALL_RUNNING_STATE_RINGING) {
-            ret = true;
-            break;
-        }
-    }
-    return ret;
+    return GetRunningStateCount(CallRunningState::CALL_RUNNING_STATE_RINGING) > 0;
 }
 
 TelCallState CallObjectManager::GetCallState(int32_t callId)
 {
-    TelCallState retState = TelCallState::CALL_STATUS_IDLE;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it = CallObjectManager::callObjectPtrList_.begin();
-    for (; it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallID() == callId) {
-            retState = (*it)->GetTelCallState();
-            break;
-        }
+    // the call is looked up in the id map of its shard, its state is read without taking the lock of the call
+    sptr<CallBase> call = GetOneCallObject(callId);
+    if (call == nullptr) {
+        return TelCallState::CALL_STATUS_IDLE;
     }
-    return retState;
+    return call->GetTelCallState();
 }
 
 sptr<CallBase> CallObjectManager::GetOneCallObject(CallRunningState callState)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::reverse_iterator it;
-    for (it = callObjectPtrList_.rbegin(); it != callObjectPtrList_.rend(); ++it) {
-        if ((*it)->GetCallRunningState() == callState) {
-            return (*it);
-        }
+    if (GetRunningStateCount(callState) == 0) {
+        return nullptr;
     }
-    return nullptr;
+    return FindCall([callState](const sptr<CallBase> &call) { return call->GetCallRunningState() == callState; },
+        true);
 }
 
 bool CallObjectManager::IsCallExist(CallType callType, TelCallState callState)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetCallType() == callType && (*it)->GetTelCallState() == callState) {
-            return true;
-        }
+    if (GetTelCallStateCount(callState) == 0) {
+        TELEPHONY_LOGI("the call is does not exist.");
+        return false;
+    }
+    sptr<CallBase> call = FindCall([callType, callState](const sptr<CallBase> &call) {
+        return call->GetCallType() == callType && call->GetTelCallState() == callState;
+    }, false);
+    if (call != nullptr) {
+        return true;
     }
     TELEPHONY_LOGI("the call is does not exist.");
     return false;
@@ -311,12 +339,8 @@ bool CallObjectManager::IsCallExist(CallType callType, TelCallState callState)
 
 bool CallObjectManager::IsCallExist(TelCallState callState)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetTelCallState() == callState) {
-            return true;
-        }
+    if (GetTelCallStateCount(callState) > 0) {
+        return true;
     }
     TELEPHONY_LOGI("the call is does not exist.");
     return false;
@@ -324,13 +348,15 @@ bool CallObjectManager::IsCallExist(TelCallState callState)
 
 bool CallObjectManager::IsCallExist(TelCallState callState, int32_t &callId)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetTelCallState() == callState) {
-            callId = (*it)->GetCallID();
-            return true;
-        }
+    if (GetTelCallStateCount(callState) == 0) {
+        TELEPHONY_LOGI("the call is does not exist.");
+        return false;
+    }
+    sptr<CallBase> call =
+        FindCall([callState](const sptr<CallBase> &call) { return call->GetTelCallState() == callState; }, false);
+    if (call != nullptr) {
+        callId = call->GetCallID();
+        return true;
     }
     TELEPHONY_LOGI("the call is does not exist.");
     return false;
@@ -338,13 +364,11 @@ bool CallObjectManager::IsCallExist(TelCallState callState, int32_t &callId)
 
 bool CallObjectManager::IsConferenceCallExist(TelConferenceState state, int32_t &callId)
 {
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetTelConferenceState() == state) {
-            callId = (*it)->GetCallID();
-            return true;
-        }
+    sptr<CallBase> call =
+        FindCall([state](const sptr<CallBase> &call) { return call->GetTelConferenceState() == state; }, false);
+    if (call != nullptr) {
+        callId = call->GetCallID();
+        return true;
     }
     TELEPHONY_LOGI("the call is does not exist.");
     return false;
@@ -352,15 +376,7 @@ bool CallObjectManager::IsConferenceCallExist(TelConferenceState state, int32_t
 
 int32_t CallObjectManager::GetCallNum(TelCallState callState)
 {
-    int32_t num = 0;
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetTelCallState() == callState) {
-            ++num;
-            continue;
-        }
-    }
+    int32_t num = GetTelCallStateCount(callState);
     TELEPHONY_LOGI("callState:%{public}d, num:%{public}d", callState, num);
     return num;
 }
@@ -368,13 +384,13 @@ int32_t CallObjectManager::GetCallNum(TelCallState callState)
 std::string CallObjectManager::GetCallNumber(TelCallState callState)
 {
     std::string number = "";
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
-        if ((*it)->GetTelCallState() == callState) {
-            number = (*it)->GetAccountNumber();
-            break;
-        }
+    if (GetTelCallStateCount(callState) == 0) {
+        return number;
+    }
+    sptr<CallBase> call =
+        FindCall([callState](const sptr<CallBase> &call) { return call->GetTelCallState() == callState; }, false);
+    if (call != nullptr) {
+        number = call->GetAccountNumber();
     }
     return number;
 }
@@ -384,16 +400,266 @@ std::vector<CallAttributeInfo> CallObjectManager::GetCallInfoList(int32_t slotId
     std::vector<CallAttributeInfo> callVec;
     CallAttributeInfo info;
     callVec.clear();
-    std::lock_guard<std::mutex> lock(listMutex_);
-    std::list<sptr<CallBase>>::iterator it;
-    for (it = callObjectPtrList_.begin(); it != callObjectPtrList_.end(); ++it) {
+    // only the shard of this slot is read, calls of the other slot are never touched
+    std::shared_ptr<const CallSnapshot> snapshot = GetCallSnapshot(callShards_[GetSlotShardIndex(slotId)]);
+    if (snapshot == nullptr) {
+        return callVec;
+    }
+    for (const CallEntry &entry : *snapshot) {
         (void)memset_s(&info, sizeof(CallAttributeInfo), 0, sizeof(CallAttributeInfo));
-        (*it)->GetCallAttributeInfo(info);
+        entry.call->GetCallAttributeInfo(info);
         if (info.accountId == slotId && info.callType != CallType::TYPE_OTT) {
             callVec.emplace_back(info);
         }
     }
     return callVec;
 }
+
+int32_t CallObjectManager::GetCallSnapshotInfoList(std::vector<CallSnapshotInfo> &callList)
+{
+    std::vector<CallEntry> entries;
+    GetAllCallEntries(entries);
+    callList.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        CallSnapshotInfo &snapshotInfo = callList[i];
+        snapshotInfo.info = *entries[i].call->GetCallAttributeSnapshot();
+        snapshotInfo.mainCallId = (snapshotInfo.info.conferenceState == TelConferenceState::TEL_CONFERENCE_IDLE) ?
+            snapshotInfo.info.callId : entries[i].call->GetMainCallId();
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void CallObjectManager::OnCallStateChanged(int32_t callId)
+{
+    int32_t shardIndex = GetCallIdShardIndex(callId);
+    if (shardIndex == ERR_ID) {
+        // the call has not been added yet or is already deleted, nothing is counted for it
+        return;
+    }
+    CallShard &shard = callShards_[shardIndex];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto iter = shard.callIdMap.find(callId);
+    auto recordIter = shard.callStateRecordMap.find(callId);
+    if (iter == shard.callIdMap.end() || recordIter == shard.callStateRecordMap.end()) {
+        return;
+    }
+    sptr<CallBase> call = iter->second.call;
+    CallStateRecord record = { call->GetCallRunningState(), call->GetTelCallState() };
+    SubStateCount(recordIter->second);
+    AddStateCount(record);
+    recordIter->second = record;
+    CallJournalRecord journalRecord;
+    CallStateJournal::FillCallStateRecord(journalRecord, call);
+    DelayedSingleton<CallStateJournal>::GetInstance()->Append(journalRecord, lock);
+}
+
+void CallObjectManager::AddCallIndexes(CallShard &shard, const CallEntry &entry)
+{
+    const sptr<CallBase> &call = entry.call;
+    int32_t callId = call->GetCallID();
+    CallStateRecord record = { call->GetCallRunningState(), call->GetTelCallState() };
+    shard.callStateRecordMap[callId] = record;
+    AddStateCount(record);
+    shard.callIdMap[callId] = entry;
+    shard.callNumberMap[NormalizeNumber(call->GetAccountNumber())].emplace_back(entry);
+    if (call->GetCallType() == CallType::TYPE_CS || call->GetCallType() == CallType::TYPE_IMS) {
+        shard.callSlotIndexMap[GetSlotIndexKey(call->GetSlotId(), call->GetCallIndex())] = call;
+    }
+    ++callCount_;
+}
+
+void CallObjectManager::DeleteCallIndexes(CallShard &shard, const sptr<CallBase> &call)
+{
+    int32_t callId = call->GetCallID();
+    auto recordIter = shard.callStateRecordMap.find(callId);
+    if (recordIter != shard.callStateRecordMap.end()) {
+        SubStateCount(recordIter->second);
+        shard.callStateRecordMap.erase(recordIter);
+    }
+    shard.callIdMap.erase(callId);
+    callIdShardIndex_[callId] = 0;
+    --callCount_;
+    auto numberIter = shard.callNumberMap.find(NormalizeNumber(call->GetAccountNumber()));
+    if (numberIter != shard.callNumberMap.end()) {
+        numberIter->second.remove_if([&call](const CallEntry &entry) { return entry.call == call; });
+        if (numberIter->second.empty()) {
+            shard.callNumberMap.erase(numberIter);
+        }
+    }
+    if (call->GetCallType() == CallType::TYPE_CS || call->GetCallType() == CallType::TYPE_IMS) {
+        auto indexIter = shard.callSlotIndexMap.find(GetSlotIndexKey(call->GetSlotId(), call->GetCallIndex()));
+        // a newer call may already have been reported with the same index
+        if (indexIter != shard.callSlotIndexMap.end() && indexIter->second == call) {
+            shard.callSlotIndexMap.erase(indexIter);
+        }
+    }
+}
+
+// releases the shard lock. The id is recycled after the record is appended, so the creation of a call
+// reusing it can not be journaled ahead of this destruction
+void CallObjectManager::RecordCallDestroyed(int32_t callId, std::unique_lock<std::mutex> &shardLock)
+{
+    CallJournalRecord journalRecord;
+    CallStateJournal::FillCallDestroyedRecord(journalRecord, callId);
+    DelayedSingleton<CallStateJournal>::GetInstance()->Append(journalRecord, shardLock);
+    callIdAllocator_.Release(callId);
+}
+
+void CallObjectManager::ClearCallShards()
+{
+    for (CallShard &shard : callShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto &callIdPair : shard.callIdMap) {
+            callIdShardIndex_[callIdPair.first] = 0;
+            callIdAllocator_.Release(callIdPair.first);
+        }
+        shard.callList.clear();
+        shard.callIdMap.clear();
+        shard.callNumberMap.clear();
+        shard.callSlotIndexMap.clear();
+        shard.callStateRecordMap.clear();
+        std::atomic_store(&shard.snapshot, std::shared_ptr<const CallSnapshot>());
+    }
+    callCount_ = 0;
+    for (auto &count : runningStateCount_) {
+        count = 0;
+    }
+    for (auto &count : telCallStateCount_) {
+        count = 0;
+    }
+}
+
+std::string CallObjectManager::NormalizeNumber(const std::string &phoneNumber)
+{
+    // drop the visual separators so that formatted and raw numbers hit the same index entry
+    std::string number;
+    number.reserve(phoneNumber.length());
+    for (char c : phoneNumber) {
+        if (c == ' ' || c == '-' || c == '(' || c == ')') {
+            continue;
+        }
+        number.push_back(c);
+    }
+    return number;
+}
+
+uint64_t CallObjectManager::GetSlotIndexKey(int32_t slotId, int32_t index)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(slotId)) << SLOT_INDEX_KEY_SHIFT) | static_cast<uint32_t>(index);
+}
+
+int32_t CallObjectManager::GetSlotShardIndex(int32_t slotId)
+{
+    if (slotId < 0 || slotId >= CALL_SLOT_SHARD_NUM) {
+        return NO_SLOT_SHARD_INDEX;
+    }
+    return slotId;
+}
+
+int32_t CallObjectManager::GetCallShardIndex(const sptr<CallBase> &call)
+{
+    if (call->GetCallType() != CallType::TYPE_CS && call->GetCallType() != CallType::TYPE_IMS) {
+        return NO_SLOT_SHARD_INDEX;
+    }
+    return GetSlotShardIndex(call->GetSlotId());
+}
+
+int32_t CallObjectManager::GetCallIdShardIndex(int32_t callId)
+{
+    if (callId <= CALL_START_ID || callId >= CALL_ID_SPACE_SIZE) {
+        return ERR_ID;
+    }
+    int32_t shardIndex = callIdShardIndex_[callId].load();
+    return (shardIndex == 0) ? ERR_ID : (shardIndex - 1);
+}
+
+void CallObjectManager::AddStateCount(const CallStateRecord &record)
+{
+    size_t runningState = static_cast<size_t>(record.runningState);
+    if (runningState < CALL_RUNNING_STATE_NUM) {
+        ++runningStateCount_[runningState];
+    }
+    size_t telCallState = static_cast<size_t>(record.telCallState);
+    if (telCallState < TEL_CALL_STATE_NUM) {
+        ++telCallStateCount_[telCallState];
+    }
+}
+
+void CallObjectManager::SubStateCount(const CallStateRecord &record)
+{
+    size_t runningState = static_cast<size_t>(record.runningState);
+    if (runningState < CALL_RUNNING_STATE_NUM) {
+        --runningStateCount_[runningState];
+    }
+    size_t telCallState = static_cast<size_t>(record.telCallState);
+    if (telCallState < TEL_CALL_STATE_NUM) {
+        --telCallStateCount_[telCallState];
+    }
+}
+
+int32_t CallObjectManager::GetRunningStateCount(CallRunningState state)
+{
+    size_t index = static_cast<size_t>(state);
+    if (index >= CALL_RUNNING_STATE_NUM) {
+        return 0;
+    }
+    return runningStateCount_[index].load();
+}
+
+int32_t CallObjectManager::GetTelCallStateCount(TelCallState state)
+{
+    size_t index = static_cast<size_t>(state);
+    if (index >= TEL_CALL_STATE_NUM) {
+        return 0;
+    }
+    return telCallStateCount_[index].load();
+}
+
+void CallObjectManager::PublishCallSnapshot(CallShard &shard)
+{
+    auto snapshot = std::make_shared<CallSnapshot>(shard.callList.begin(), shard.callList.end());
+    std::atomic_store(&shard.snapshot, std::shared_ptr<const CallSnapshot>(std::move(snapshot)));
+}
+
+std::shared_ptr<const CallObjectManager::CallSnapshot> CallObjectManager::GetCallSnapshot(const CallShard &shard)
+{
+    return std::atomic_load(&shard.snapshot);
+}
+
+template<typename Predicate>
+sptr<CallBase> CallObjectManager::FindCall(Predicate predicate, bool isLatest)
+{
+    // the first (or latest) matching call across all shards, in the order the calls were added
+    CallEntry found = { 0, nullptr };
+    for (const CallShard &shard : callShards_) {
+        std::shared_ptr<const CallSnapshot> snapshot = GetCallSnapshot(shard);
+        if (snapshot == nullptr) {
+            continue;
+        }
+        for (const CallEntry &entry : *snapshot) {
+            if (found.call != nullptr && (isLatest ? (entry.sequence < found.sequence) :
+                (entry.sequence > found.sequence))) {
+                continue;
+            }
+            if (predicate(entry.call)) {
+                found = entry;
+            }
+        }
+    }
+    return found.call;
+}
+
+void CallObjectManager::GetAllCallEntries(std::vector<CallEntry> &entries)
+{
+    entries.clear();
+    for (const CallShard &shard : callShards_) {
+        std::shared_ptr<const CallSnapshot> snapshot = GetCallSnapshot(shard);
+        if (snapshot != nullptr) {
+            entries.insert(entries.end(), snapshot->begin(), snapshot->end());
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+        [](const CallEntry &left, const CallEntry &right) { return left.sequence < right.sequence; });
+}
 } // namespace Telephony
 } // namespace OHOS
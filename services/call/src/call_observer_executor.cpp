@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_observer_executor.h"
+
+#include "telephony_log_wrapper.h"
+
+#include "call_state_listener_base.h"
+
+namespace OHOS {
+namespace Telephony {
+CallObserverExecutor::CallObserverExecutor() : eventLoop_(nullptr), handler_(nullptr) {}
+
+CallObserverExecutor::~CallObserverExecutor()
+{
+    if (eventLoop_ != nullptr) {
+        eventLoop_->Stop();
+    }
+}
+
+void CallObserverExecutor::Start()
+{
+    eventLoop_ = AppExecFwk::EventRunner::Create("CallObserverExecutor");
+    if (eventLoop_.get() == nullptr) {
+        TELEPHONY_LOGE("failed to create EventRunner");
+        return;
+    }
+    handler_ = std::make_shared<AppExecFwk::EventHandler>(eventLoop_);
+    if (handler_.get() == nullptr) {
+        TELEPHONY_LOGE("failed to create EventHandler");
+        return;
+    }
+    eventLoop_->Run();
+}
+
+void CallObserverExecutor::Execute(const sptr<CallStateListenerBase> &observer, std::function<void()> task)
+{
+    if (observer == nullptr || task == nullptr) {
+        return;
+    }
+    if (handler_ == nullptr) {
+        // without the executor thread the observer is called inline, as before
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ObserverQueue &queue = queueMap_[observer.GetRefPtr()];
+        queue.isRemoved = false;
+        queue.tasks.emplace_back(std::move(task));
+        if (queue.isScheduled) {
+            return;
+        }
+        queue.isScheduled = true;
+    }
+    if (!ScheduleQueue(observer)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queueMap_.erase(observer.GetRefPtr());
+    }
+}
+
+void CallObserverExecutor::RemoveObserver(const sptr<CallStateListenerBase> &observer)
+{
+    if (observer == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = queueMap_.find(observer.GetRefPtr());
+    if (iter == queueMap_.end()) {
+        return;
+    }
+    if (!iter->second.isScheduled) {
+        queueMap_.erase(iter);
+        return;
+    }
+    // the scheduled task still holds the observer, it finds the entry removed and erases it
+    iter->second.tasks.clear();
+    iter->second.isRemoved = true;
+}
+
+bool CallObserverExecutor::ScheduleQueue(const sptr<CallStateListenerBase> &observer)
+{
+    // the sptr held by the posted task keeps the observer alive until its queue is empty
+    sptr<CallStateListenerBase> holder = observer;
+    if (!handler_->PostTask([this, holder]() { RunNextTask(holder); })) {
+        TELEPHONY_LOGE("post observer task failed, its pending events are dropped");
+        return false;
+    }
+    return true;
+}
+
+void CallObserverExecutor::RunNextTask(const sptr<CallStateListenerBase> &observer)
+{
+    std::function<void()> task = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = queueMap_.find(observer.GetRefPtr());
+        if (iter == queueMap_.end()) {
+            return;
+        }
+        if (iter->second.isRemoved || iter->second.tasks.empty()) {
+            queueMap_.erase(iter);
+            return;
+        }
+        task = std::move(iter->second.tasks.front());
+        iter->second.tasks.pop_front();
+    }
+    task();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = queueMap_.find(observer.GetRefPtr());
+        if (iter == queueMap_.end()) {
+            return;
+        }
+        if (iter->second.isRemoved) {
+            queueMap_.erase(iter);
+            return;
+        }
+        if (iter->second.tasks.empty()) {
+            iter->second.isScheduled = false;
+            return;
+        }
+    }
+    // go to the back of the executor queue, the other observers run their next event first
+    if (!ScheduleQueue(observer)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queueMap_.erase(observer.GetRefPtr());
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
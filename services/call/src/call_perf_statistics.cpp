@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "call_perf_statistics.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+const char *const CALL_EVENT_QUEUE_NAMES[CALL_EVENT_QUEUE_NUM] = {
+    "request",
+    "report",
+    "records",
+};
+
+const char *const CALL_PERF_TIMER_NAMES[CALL_PERF_TIMER_NUM] = {
+    "critical_observer",
+    "best_effort_observer",
+    "ringtone_start",
+    "tone_start",
+    "audio_activate",
+    "urgent_request_wait",
+    "answer_request_wait",
+    "normal_request_wait",
+};
+} // namespace
+
+std::atomic<int32_t> CallPerfStatistics::queueDepth_[CALL_EVENT_QUEUE_NUM] = {};
+std::atomic<int32_t> CallPerfStatistics::maxQueueDepth_[CALL_EVENT_QUEUE_NUM] = {};
+CallLatencyHistogram CallPerfStatistics::timers_[CALL_PERF_TIMER_NUM];
+
+void CallPerfStatistics::OnEventQueued(CallEventQueueType type)
+{
+    if (type >= CALL_EVENT_QUEUE_NUM) {
+        return;
+    }
+    int32_t depth = queueDepth_[type].fetch_add(1, std::memory_order_relaxed) + 1;
+    int32_t maxDepth = maxQueueDepth_[type].load(std::memory_order_relaxed);
+    while (depth > maxDepth &&
+        !maxQueueDepth_[type].compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {}
+}
+
+void CallPerfStatistics::OnEventProcessed(CallEventQueueType type)
+{
+    if (type >= CALL_EVENT_QUEUE_NUM) {
+        return;
+    }
+    queueDepth_[type].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void CallPerfStatistics::RecordTime(CallPerfTimerType type, int64_t beginTime)
+{
+    if (type >= CALL_PERF_TIMER_NUM) {
+        return;
+    }
+    timers_[type].Record(CallLatencyTracer::GetElapsedTime(beginTime));
+}
+
+void CallPerfStatistics::Dump(std::string &result)
+{
+    result.append("Ohos call_manager event queue depth:\n");
+    for (uint32_t i = 0; i < CALL_EVENT_QUEUE_NUM; ++i) {
+        result.append("  ")
+            .append(CALL_EVENT_QUEUE_NAMES[i])
+            .append(" current:")
+            .append(std::to_string(queueDepth_[i].load(std::memory_order_relaxed)))
+            .append(" max:")
+            .append(std::to_string(maxQueueDepth_[i].load(std::memory_order_relaxed)))
+            .append("\n");
+    }
+    result.append("Ohos call_manager observer, audio and request queue wait time(microseconds):\n");
+    for (uint32_t i = 0; i < CALL_PERF_TIMER_NUM; ++i) {
+        result.append("  ").append(CALL_PERF_TIMER_NAMES[i]);
+        timers_[i].Dump(result);
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -139,6 +139,39 @@ int32_t CallPolicy::HangUpPolicy(int32_t callId)
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallPolicy::AnswerAndHoldActivePolicy(int32_t callId, int32_t videoState)
+{
+    int32_t ret = AnswerCallPolicy(callId, videoState);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    // the active call can not be held while another call is already on hold
+    if (GetOneCallObject(CallRunningState::CALL_RUNNING_STATE_ACTIVE) != nullptr &&
+        IsCallExist(TelCallState::CALL_STATUS_HOLDING)) {
+        TELEPHONY_LOGE("a call is already on hold, callId:%{public}d", callId);
+        return CALL_ERR_ILLEGAL_CALL_OPERATION;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallPolicy::HangUpAllPolicy()
+{
+    if (!HasCallExist()) {
+        TELEPHONY_LOGE("there is no call to hang up");
+        return CALL_ERR_PHONE_CALLS_TOO_FEW;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallPolicy::HangUpAllOnSlotPolicy(int32_t slotId)
+{
+    if (!DelayedSingleton<CallNumberUtils>::GetInstance()->IsValidSlotId(slotId)) {
+        TELEPHONY_LOGE("invalid slotId!");
+        return CALL_ERR_INVALID_SLOT_ID;
+    }
+    return HangUpAllPolicy();
+}
+
 int32_t CallPolicy::SwitchCallPolicy(int32_t callId)
 {
     std::list<int32_t> callIdList;
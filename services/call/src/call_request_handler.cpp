@@ -21,28 +21,65 @@
 #include "call_manager_errors.h"
 #include "telephony_log_wrapper.h"
 
+#include "call_latency_tracer.h"
+
 namespace OHOS {
 namespace Telephony {
+namespace {
+const AppExecFwk::EventQueue::Priority CALL_REQUEST_LANE_PRIORITIES[CALL_REQUEST_LANE_NUM] = {
+    AppExecFwk::EventQueue::Priority::IMMEDIATE,
+    AppExecFwk::EventQueue::Priority::HIGH,
+    AppExecFwk::EventQueue::Priority::LOW,
+};
+
+const CallPerfTimerType CALL_REQUEST_LANE_WAIT_TIMERS[CALL_REQUEST_LANE_NUM] = {
+    CALL_PERF_TIMER_URGENT_REQUEST_WAIT,
+    CALL_PERF_TIMER_ANSWER_REQUEST_WAIT,
+    CALL_PERF_TIMER_NORMAL_REQUEST_WAIT,
+};
+
+int64_t GetEventSendTime(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(event->GetSendTime().time_since_epoch()).count();
+}
+
+bool IsValidRequestCallId(int32_t callId)
+{
+    return callId > CALL_START_ID && callId < CALL_ID_SPACE_SIZE;
+}
+} // namespace
+
+constexpr CallDispatchTable<CallRequestHandler::CallRequestFunc, CallRequestHandlerService::HANDLER_REQUEST_NUM>
+    CallRequestHandler::memberFuncTable_({
+        { CallRequestHandlerService::HANDLER_DIAL_CALL_REQUEST, &CallRequestHandler::DialCallEvent },
+        { CallRequestHandlerService::HANDLER_ANSWER_CALL_REQUEST, &CallRequestHandler::AcceptCallEvent },
+        { CallRequestHandlerService::HANDLER_REJECT_CALL_REQUEST, &CallRequestHandler::RejectCallEvent },
+        { CallRequestHandlerService::HANDLER_HANGUP_CALL_REQUEST, &CallRequestHandler::HangUpCallEvent },
+        { CallRequestHandlerService::HANDLER_HOLD_CALL_REQUEST, &CallRequestHandler::HoldCallEvent },
+        { CallRequestHandlerService::HANDLER_UNHOLD_CALL_REQUEST, &CallRequestHandler::UnHoldCallEvent },
+        { CallRequestHandlerService::HANDLER_SWAP_CALL_REQUEST, &CallRequestHandler::SwitchCallEvent },
+        { CallRequestHandlerService::HANDLER_COMBINE_CONFERENCE_REQUEST, &CallRequestHandler::CombineConferenceEvent },
+        { CallRequestHandlerService::HANDLER_SEPARATE_CONFERENCE_REQUEST,
+            &CallRequestHandler::SeparateConferenceEvent },
+        { CallRequestHandlerService::HANDLER_UPDATE_CALL_MEDIA_MODE_REQUEST,
+            &CallRequestHandler::UpdateCallMediaModeEvent },
+        { CallRequestHandlerService::HANDLER_STARTRTT_REQUEST, &CallRequestHandler::StartRttEvent },
+        { CallRequestHandlerService::HANDLER_STOPRTT_REQUEST, &CallRequestHandler::StopRttEvent },
+        { CallRequestHandlerService::HANDLER_INVITE_TO_CONFERENCE, &CallRequestHandler::JoinConferenceEvent },
+        { CallRequestHandlerService::HANDLER_ANSWER_AND_HOLD_ACTIVE_REQUEST,
+            &CallRequestHandler::AnswerAndHoldActiveEvent },
+        { CallRequestHandlerService::HANDLER_ANSWER_AND_END_ACTIVE_REQUEST,
+            &CallRequestHandler::AnswerAndEndActiveEvent },
+        { CallRequestHandlerService::HANDLER_HANGUP_ALL_REQUEST, &CallRequestHandler::HangUpAllEvent },
+        { CallRequestHandlerService::HANDLER_EMERGENCY_DIAL_CALL_REQUEST, &CallRequestHandler::DialCallEvent },
+    });
+
 CallRequestHandler::CallRequestHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
-    : AppExecFwk::EventHandler(runner), callRequestProcessPtr_(nullptr)
-{
-    memberFuncMap_[CallRequestHandlerService::HANDLER_DIAL_CALL_REQUEST] = &CallRequestHandler::DialCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_ANSWER_CALL_REQUEST] = &CallRequestHandler::AcceptCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_REJECT_CALL_REQUEST] = &CallRequestHandler::RejectCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_HANGUP_CALL_REQUEST] = &CallRequestHandler::HangUpCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_HOLD_CALL_REQUEST] = &CallRequestHandler::HoldCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_UNHOLD_CALL_REQUEST] = &CallRequestHandler::UnHoldCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_SWAP_CALL_REQUEST] = &CallRequestHandler::SwitchCallEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_COMBINE_CONFERENCE_REQUEST] =
-        &CallRequestHandler::CombineConferenceEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_SEPARATE_CONFERENCE_REQUEST] =
-        &CallRequestHandler::SeparateConferenceEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_UPDATE_CALL_MEDIA_MODE_REQUEST] =
-        &CallRequestHandler::UpdateCallMediaModeEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_STARTRTT_REQUEST] = &CallRequestHandler::StartRttEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_STOPRTT_REQUEST] = &CallRequestHandler::StopRttEvent;
-    memberFuncMap_[CallRequestHandlerService::HANDLER_INVITE_TO_CONFERENCE] =
-        &CallRequestHandler::JoinConferenceEvent;
+    : AppExecFwk::EventHandler(runner), callRequestProcessPtr_(nullptr), hangUpAllSeq_(0)
+{
+    for (auto &seq : hangUpSeq_) {
+        seq.store(0, std::memory_order_relaxed);
+    }
 }
 
 CallRequestHandler::~CallRequestHandler()
@@ -65,13 +102,13 @@ void CallRequestHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &eve
         TELEPHONY_LOGE("CallRequestHandler::ProcessEvent parameter error");
         return;
     }
+    CallPerfStatistics::OnEventProcessed(CALL_EVENT_QUEUE_REQUEST);
+    CallRequestLane lane = CallRequestHandlerService::GetRequestLane(event->GetInnerEventId());
+    CallPerfStatistics::RecordTime(CALL_REQUEST_LANE_WAIT_TIMERS[lane], GetEventSendTime(event));
     TELEPHONY_LOGI("CallRequestHandler inner event id obtained: %{public}u.", event->GetInnerEventId());
-    auto itFunc = memberFuncMap_.find(event->GetInnerEventId());
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
-            return (this->*memberFunc)(event);
-        }
+    auto memberFunc = memberFuncTable_.Find(event->GetInnerEventId());
+    if (memberFunc != nullptr) {
+        return (this->*memberFunc)(event);
     }
 }
 
@@ -85,6 +122,8 @@ void CallRequestHandler::DialCallEvent(const AppExecFwk::InnerEvent::Pointer &ev
         TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
         return;
     }
+    CallLatencyTraceScope traceScope(event->GetParam());
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_DIAL_QUEUE);
     callRequestProcessPtr_->DialRequest();
 }
 
@@ -152,17 +191,20 @@ void CallRequestHandler::HoldCallEvent(const AppExecFwk::InnerEvent::Pointer &ev
         TELEPHONY_LOGE("CallRequestHandler::ProcessEvent parameter error");
         return;
     }
-    auto object = event->GetUniqueObject<int32_t>();
+    auto object = event->GetUniqueObject<HoldCallPara>();
     if (object == nullptr) {
         TELEPHONY_LOGE("object is nullptr!");
         return;
     }
-    int32_t callId = *object;
+    if (IsHoldSuperseded(*object)) {
+        TELEPHONY_LOGI("the call is hung up after the hold was queued, callId:%{public}d", object->callId);
+        return;
+    }
     if (callRequestProcessPtr_ == nullptr) {
         TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
         return;
     }
-    callRequestProcessPtr_->HoldRequest(callId);
+    callRequestProcessPtr_->HoldRequest(object->callId);
 }
 
 void CallRequestHandler::UnHoldCallEvent(const AppExecFwk::InnerEvent::Pointer &event)
@@ -315,6 +357,98 @@ void CallRequestHandler::JoinConferenceEvent(const AppExecFwk::InnerEvent::Point
     callRequestProcessPtr_->JoinConference(object->callId, object->numberList);
 }
 
+void CallRequestHandler::OnHangUpQueued(int32_t callId)
+{
+    if (IsValidRequestCallId(callId)) {
+        hangUpSeq_[callId].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void CallRequestHandler::OnHangUpAllQueued()
+{
+    hangUpAllSeq_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// every call on the slot is superseded as if it was hung up alone, holds queued on other slots still run
+void CallRequestHandler::OnHangUpSlotQueued(int32_t slotId)
+{
+    std::list<sptr<CallBase>> callList;
+    CallObjectManager::GetAllCallList(callList);
+    for (const sptr<CallBase> &call : callList) {
+        if (call != nullptr && call->GetCallType() != CallType::TYPE_OTT && call->GetSlotId() == slotId) {
+            OnHangUpQueued(call->GetCallID());
+        }
+    }
+}
+
+void CallRequestHandler::GetHoldCallPara(int32_t callId, HoldCallPara &para)
+{
+    para.callId = callId;
+    para.hangUpSeq = IsValidRequestCallId(callId) ? hangUpSeq_[callId].load(std::memory_order_relaxed) : 0;
+    para.hangUpAllSeq = hangUpAllSeq_.load(std::memory_order_relaxed);
+}
+
+bool CallRequestHandler::IsHoldSuperseded(const HoldCallPara &para)
+{
+    HoldCallPara current;
+    GetHoldCallPara(para.callId, current);
+    return current.hangUpSeq != para.hangUpSeq || current.hangUpAllSeq != para.hangUpAllSeq;
+}
+
+void CallRequestHandler::AnswerAndHoldActiveEvent(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        TELEPHONY_LOGE("CallRequestHandler::AnswerAndHoldActiveEvent parameter error");
+        return;
+    }
+    auto object = event->GetUniqueObject<AnswerCallPara>();
+    if (object == nullptr) {
+        TELEPHONY_LOGE("object is nullptr!");
+        return;
+    }
+    if (callRequestProcessPtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
+        return;
+    }
+    callRequestProcessPtr_->AnswerAndHoldActiveRequest(object->callId, object->videoState);
+}
+
+void CallRequestHandler::AnswerAndEndActiveEvent(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        TELEPHONY_LOGE("CallRequestHandler::AnswerAndEndActiveEvent parameter error");
+        return;
+    }
+    auto object = event->GetUniqueObject<AnswerCallPara>();
+    if (object == nullptr) {
+        TELEPHONY_LOGE("object is nullptr!");
+        return;
+    }
+    if (callRequestProcessPtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
+        return;
+    }
+    callRequestProcessPtr_->AnswerAndEndActiveRequest(object->callId, object->videoState);
+}
+
+void CallRequestHandler::HangUpAllEvent(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        TELEPHONY_LOGE("CallRequestHandler::HangUpAllEvent parameter error");
+        return;
+    }
+    auto object = event->GetUniqueObject<HangUpAllPara>();
+    if (object == nullptr) {
+        TELEPHONY_LOGE("object is nullptr!");
+        return;
+    }
+    if (callRequestProcessPtr_ == nullptr) {
+        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
+        return;
+    }
+    callRequestProcessPtr_->HangUpAllRequest(object->isAllSlots, object->slotId);
+}
+
 CallRequestHandlerService::CallRequestHandlerService() : eventLoop_(nullptr), handler_(nullptr) {}
 
 CallRequestHandlerService::~CallRequestHandlerService()
@@ -343,13 +477,36 @@ void CallRequestHandlerService::Start()
     return;
 }
 
-int32_t CallRequestHandlerService::DialCall()
+CallRequestLane CallRequestHandlerService::GetRequestLane(uint32_t eventId)
+{
+    switch (eventId) {
+        case HANDLER_EMERGENCY_DIAL_CALL_REQUEST:
+        case HANDLER_REJECT_CALL_REQUEST:
+        case HANDLER_HANGUP_CALL_REQUEST:
+        case HANDLER_HANGUP_ALL_REQUEST:
+            return CALL_REQUEST_LANE_URGENT;
+        case HANDLER_ANSWER_CALL_REQUEST:
+        case HANDLER_ANSWER_AND_HOLD_ACTIVE_REQUEST:
+        case HANDLER_ANSWER_AND_END_ACTIVE_REQUEST:
+            return CALL_REQUEST_LANE_ANSWER;
+        default:
+            return CALL_REQUEST_LANE_NORMAL;
+    }
+}
+
+AppExecFwk::EventQueue::Priority CallRequestHandlerService::GetRequestPriority(uint32_t eventId)
+{
+    return CALL_REQUEST_LANE_PRIORITIES[GetRequestLane(eventId)];
+}
+
+int32_t CallRequestHandlerService::DialCall(bool isEcc)
 {
     if (handler_.get() == nullptr) {
         TELEPHONY_LOGE("handler_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_DIAL_CALL_REQUEST)) {
+    uint32_t eventId = isEcc ? HANDLER_EMERGENCY_DIAL_CALL_REQUEST : HANDLER_DIAL_CALL_REQUEST;
+    if (!SendHandlerEvent(eventId, CallLatencyTracer::GetTraceBeginTime())) {
         TELEPHONY_LOGE("send dial event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -369,7 +526,7 @@ int32_t CallRequestHandlerService::AnswerCall(int32_t callId, int32_t videoState
     }
     para->callId = callId;
     para->videoState = videoState;
-    if (!handler_->SendEvent(HANDLER_ANSWER_CALL_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_ANSWER_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send accept event failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
@@ -396,7 +553,7 @@ int32_t CallRequestHandlerService::RejectCall(int32_t callId, bool isSendSms, st
         TELEPHONY_LOGE("memcpy_s rejectCall content failed!");
         return TELEPHONY_ERR_MEMCPY_FAIL;
     }
-    if (!handler_->SendEvent(HANDLER_REJECT_CALL_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_REJECT_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send reject event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -414,7 +571,8 @@ int32_t CallRequestHandlerService::HangUpCall(int32_t callId)
         TELEPHONY_LOGE("make_unique callId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_HANGUP_CALL_REQUEST, std::move(para))) {
+    handler_->OnHangUpQueued(callId);
+    if (!SendHandlerEvent(HANDLER_HANGUP_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send hung up event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -427,12 +585,13 @@ int32_t CallRequestHandlerService::HoldCall(int32_t callId)
         TELEPHONY_LOGE("handler_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    std::unique_ptr<int32_t> para = std::make_unique<int32_t>(callId);
+    std::unique_ptr<HoldCallPara> para = std::make_unique<HoldCallPara>();
     if (para.get() == nullptr) {
-        TELEPHONY_LOGE("make_unique callId failed!");
+        TELEPHONY_LOGE("make_unique HoldCallPara failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_HOLD_CALL_REQUEST, std::move(para))) {
+    handler_->GetHoldCallPara(callId, *para);
+    if (!SendHandlerEvent(HANDLER_HOLD_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send hold event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -450,7 +609,7 @@ int32_t CallRequestHandlerService::UnHoldCall(int32_t callId)
         TELEPHONY_LOGE("make_unique callId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_UNHOLD_CALL_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_UNHOLD_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send unHold event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -468,7 +627,7 @@ int32_t CallRequestHandlerService::SwitchCall(int32_t callId)
         TELEPHONY_LOGE("make_unique callId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_SWAP_CALL_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_SWAP_CALL_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send swap event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -488,7 +647,7 @@ int32_t CallRequestHandlerService::StartRtt(int32_t callId, std::u16string &msg)
     }
     para->callId = callId;
     para->msg = msg;
-    if (!handler_->SendEvent(HANDLER_STARTRTT_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_STARTRTT_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send StartRtt event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -506,7 +665,7 @@ int32_t CallRequestHandlerService::StopRtt(int32_t callId)
         TELEPHONY_LOGE("make_unique callId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_STOPRTT_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_STOPRTT_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send StopRtt event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -526,13 +685,78 @@ int32_t CallRequestHandlerService::JoinConference(int32_t callId, std::vector<st
     }
     para->callId = callId;
     para->numberList = numberList;
-    if (!handler_->SendEvent(HANDLER_INVITE_TO_CONFERENCE, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_INVITE_TO_CONFERENCE, std::move(para))) {
         TELEPHONY_LOGE("send JoinConference event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallRequestHandlerService::AnswerAndHoldActive(int32_t callId, int32_t videoState)
+{
+    return SendAnswerEvent(HANDLER_ANSWER_AND_HOLD_ACTIVE_REQUEST, callId, videoState);
+}
+
+int32_t CallRequestHandlerService::AnswerAndEndActive(int32_t callId, int32_t videoState)
+{
+    return SendAnswerEvent(HANDLER_ANSWER_AND_END_ACTIVE_REQUEST, callId, videoState);
+}
+
+int32_t CallRequestHandlerService::HangUpAll()
+{
+    return SendHangUpAllEvent(true, 0);
+}
+
+int32_t CallRequestHandlerService::HangUpAllOnSlot(int32_t slotId)
+{
+    return SendHangUpAllEvent(false, slotId);
+}
+
+int32_t CallRequestHandlerService::SendAnswerEvent(uint32_t eventId, int32_t callId, int32_t videoState)
+{
+    if (handler_.get() == nullptr) {
+        TELEPHONY_LOGE("handler_ is nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    std::unique_ptr<AnswerCallPara> para = std::make_unique<AnswerCallPara>();
+    if (para.get() == nullptr) {
+        TELEPHONY_LOGE("make_unique AnswerCallPara failed!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    para->callId = callId;
+    para->videoState = videoState;
+    if (!SendHandlerEvent(eventId, std::move(para))) {
+        TELEPHONY_LOGE("send answer event %{public}u failed!", eventId);
+        return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallRequestHandlerService::SendHangUpAllEvent(bool isAllSlots, int32_t slotId)
+{
+    if (handler_.get() == nullptr) {
+        TELEPHONY_LOGE("handler_ is nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    std::unique_ptr<HangUpAllPara> para = std::make_unique<HangUpAllPara>();
+    if (para.get() == nullptr) {
+        TELEPHONY_LOGE("make_unique HangUpAllPara failed!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    para->isAllSlots = isAllSlots;
+    para->slotId = slotId;
+    if (isAllSlots) {
+        handler_->OnHangUpAllQueued();
+    } else {
+        handler_->OnHangUpSlotQueued(slotId);
+    }
+    if (!SendHandlerEvent(HANDLER_HANGUP_ALL_REQUEST, std::move(para))) {
+        TELEPHONY_LOGE("send hang up all event failed!");
+        return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallRequestHandlerService::CombineConference(int32_t mainCallId)
 {
     if (handler_.get() == nullptr) {
@@ -544,7 +768,7 @@ int32_t CallRequestHandlerService::CombineConference(int32_t mainCallId)
         TELEPHONY_LOGE("make_unique mainCallId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_COMBINE_CONFERENCE_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_COMBINE_CONFERENCE_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send CombineConference event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -562,7 +786,7 @@ int32_t CallRequestHandlerService::SeparateConference(int32_t callId)
         TELEPHONY_LOGE("make_unique callId failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    if (!handler_->SendEvent(HANDLER_SEPARATE_CONFERENCE_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_SEPARATE_CONFERENCE_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send SeparateConference event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -582,7 +806,7 @@ int32_t CallRequestHandlerService::UpdateImsCallMode(int32_t callId, ImsCallMode
     }
     para->callId = callId;
     para->mode = mode;
-    if (!handler_->SendEvent(HANDLER_UPDATE_CALL_MEDIA_MODE_REQUEST, std::move(para))) {
+    if (!SendHandlerEvent(HANDLER_UPDATE_CALL_MEDIA_MODE_REQUEST, std::move(para))) {
         TELEPHONY_LOGE("send UpdateImsCallMode event failed!");
         return CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE;
     }
@@ -126,6 +126,60 @@ void CallRequestProcess::HangUpRequest(int32_t callId)
     }
 }
 
+void CallRequestProcess::AnswerAndHoldActiveRequest(int32_t callId, int32_t videoState)
+{
+    sptr<CallBase> call = GetCallToAnswer(callId);
+    if (call == nullptr) {
+        return;
+    }
+    sptr<CallBase> activeCall = GetOneCallObject(CallRunningState::CALL_RUNNING_STATE_ACTIVE);
+    if (activeCall != nullptr && activeCall->HoldCall() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("hold the active call failed, the incoming call is not answered");
+        return;
+    }
+    AnswerRequest(callId, videoState);
+}
+
+void CallRequestProcess::AnswerAndEndActiveRequest(int32_t callId, int32_t videoState)
+{
+    sptr<CallBase> call = GetCallToAnswer(callId);
+    if (call == nullptr) {
+        return;
+    }
+    sptr<CallBase> activeCall = GetOneCallObject(CallRunningState::CALL_RUNNING_STATE_ACTIVE);
+    // hung up directly, a held call must not be recovered in place of the answered one
+    if (activeCall != nullptr && activeCall->HangUpCall() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("hang up the active call failed, the incoming call is not answered");
+        return;
+    }
+    AnswerRequest(callId, videoState);
+}
+
+void CallRequestProcess::HangUpAllRequest(bool isAllSlots, int32_t slotId)
+{
+    std::list<sptr<CallBase>> callList;
+    GetAllCallList(callList);
+    // the active calls go last, so no held call is recovered while the others are released
+    std::list<sptr<CallBase>> activeCallList;
+    for (auto &call : callList) {
+        if (!IsCallToHangUp(call, isAllSlots, slotId)) {
+            continue;
+        }
+        if (call->GetTelCallState() == TelCallState::CALL_STATUS_ACTIVE) {
+            activeCallList.emplace_back(call);
+            continue;
+        }
+        if (call->HangUpCall() != TELEPHONY_SUCCESS) {
+            TELEPHONY_LOGE("HangUpCall failed, callId:%{public}d", call->GetCallID());
+        }
+    }
+    for (auto &call : activeCallList) {
+        if (call->HangUpCall() != TELEPHONY_SUCCESS) {
+            TELEPHONY_LOGE("HangUpCall failed, callId:%{public}d", call->GetCallID());
+        }
+    }
+}
+
 void CallRequestProcess::HoldRequest(int32_t callId)
 {
     sptr<CallBase> call = GetOneCallObject(callId);
@@ -263,6 +317,35 @@ void CallRequestProcess::JoinConference(int32_t callId, std::vector<std::string>
     }
 }
 
+sptr<CallBase> CallRequestProcess::GetCallToAnswer(int32_t callId)
+{
+    sptr<CallBase> call = GetOneCallObject(callId);
+    if (call == nullptr) {
+        TELEPHONY_LOGE("the call object is nullptr, callId:%{public}d", callId);
+        return nullptr;
+    }
+    // checked again on the request thread, the call may have changed since the policy passed
+    TelCallState state = call->GetTelCallState();
+    if (state != TelCallState::CALL_STATUS_INCOMING && state != TelCallState::CALL_STATUS_WAITING) {
+        TELEPHONY_LOGE("current call state is:%{public}d, accept call not allowed", state);
+        return nullptr;
+    }
+    return call;
+}
+
+bool CallRequestProcess::IsCallToHangUp(const sptr<CallBase> &call, bool isAllSlots, int32_t slotId)
+{
+    if (call == nullptr) {
+        return false;
+    }
+    if (!isAllSlots && (call->GetCallType() == CallType::TYPE_OTT || call->GetSlotId() != slotId)) {
+        return false;
+    }
+    TelCallState state = call->GetTelCallState();
+    return state != TelCallState::CALL_STATUS_IDLE && state != TelCallState::CALL_STATUS_DISCONNECTING &&
+        state != TelCallState::CALL_STATUS_DISCONNECTED;
+}
+
 void CallRequestProcess::CarrierDialProcess(DialParaInfo &info)
 {
     CellularCallInfo callInfo;
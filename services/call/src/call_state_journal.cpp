@@ -0,0 +1,400 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_state_journal.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "securec.h"
+
+#include "call_manager_errors.h"
+#include "telephony_log_wrapper.h"
+
+#include "call_object_manager.h"
+#include "cs_call.h"
+#include "ims_call.h"
+#include "ott_call.h"
+
+namespace OHOS {
+namespace Telephony {
+constexpr const char *CALL_JOURNAL_FILE_PATH = "/data/telephony/call_manager_journal";
+constexpr uint32_t CALL_JOURNAL_MAGIC = 0x4C4A4D43;
+constexpr uint32_t CALL_JOURNAL_RECORD_MAGIC = 0x52434A43;
+constexpr uint32_t CALL_JOURNAL_VERSION = 1;
+constexpr int64_t MILLISECONDS_PER_SECOND = 1000;
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+
+CallStateJournal::CallStateJournal()
+    : header_(nullptr), records_(nullptr), mapAddr_(MAP_FAILED), mapSize_(0), recoveryTime_(0), recoveredCallNum_(0)
+{}
+
+CallStateJournal::~CallStateJournal()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (mapAddr_ != MAP_FAILED) {
+        (void)munmap(mapAddr_, mapSize_);
+        mapAddr_ = MAP_FAILED;
+    }
+    header_ = nullptr;
+    records_ = nullptr;
+}
+
+int32_t CallStateJournal::Init()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (mapAddr_ != MAP_FAILED) {
+        return TELEPHONY_SUCCESS;
+    }
+    size_t mapSize = sizeof(CallJournalHeader) + sizeof(CallJournalRecord) * CALL_JOURNAL_RECORD_NUM;
+    int32_t fd = open(CALL_JOURNAL_FILE_PATH, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        TELEPHONY_LOGE("open call journal failed, errno:%{public}d", errno);
+        return TELEPHONY_ERR_FAIL;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 ||
+        (static_cast<size_t>(fileStat.st_size) != mapSize && ftruncate(fd, static_cast<off_t>(mapSize)) != 0)) {
+        TELEPHONY_LOGE("resize call journal failed, errno:%{public}d", errno);
+        close(fd);
+        return TELEPHONY_ERR_FAIL;
+    }
+    // a shared mapping lives in the page cache, records written before a crash of the process are not lost
+    void *mapAddr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapAddr == MAP_FAILED) {
+        TELEPHONY_LOGE("mmap call journal failed, errno:%{public}d", errno);
+        return TELEPHONY_ERR_FAIL;
+    }
+    mapAddr_ = mapAddr;
+    mapSize_ = mapSize;
+    header_ = static_cast<CallJournalHeader *>(mapAddr);
+    records_ = reinterpret_cast<CallJournalRecord *>(static_cast<char *>(mapAddr) + sizeof(CallJournalHeader));
+    if (header_->magic != CALL_JOURNAL_MAGIC || header_->version != CALL_JOURNAL_VERSION ||
+        header_->recordNum > CALL_JOURNAL_RECORD_NUM) {
+        TELEPHONY_LOGI("call journal is empty or from another version, reset it");
+        ResetLocked();
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+/**
+ * rebuilds the calls that were alive when the service stopped unexpectedly. The journal is compacted
+ * to the recovered calls, so the time a recovery takes is bounded by CALL_JOURNAL_RECORD_NUM records.
+ */
+int32_t CallStateJournal::Recover()
+{
+    std::chrono::steady_clock::time_point beginTime = std::chrono::steady_clock::now();
+    std::vector<CallJournalRecord> callRecords;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (header_ == nullptr) {
+            TELEPHONY_LOGE("call journal is not initialized");
+            return TELEPHONY_ERR_UNINIT;
+        }
+        if (header_->updateTime > GetBootTime()) {
+            TELEPHONY_LOGI("the device rebooted since the last journal update, no call to recover");
+        } else {
+            ReplayLocked(callRecords);
+        }
+        // the restored calls journal themselves again while they are added below
+        ResetLocked();
+    }
+    int32_t callNum = 0;
+    for (const CallJournalRecord &record : callRecords) {
+        if (RestoreCall(record) != nullptr) {
+            ++callNum;
+        }
+    }
+    recoveredCallNum_ = callNum;
+    recoveryTime_ =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - beginTime).count();
+    TELEPHONY_LOGI("recovered %{public}d calls from journal, cost time:%{public}lld(milliseconds)", callNum,
+        static_cast<long long>(recoveryTime_));
+    return TELEPHONY_SUCCESS;
+}
+
+void CallStateJournal::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return;
+    }
+    ResetLocked();
+}
+
+// takes the lock of the call, so it is filled before the call is added to the registry
+void CallStateJournal::FillCallCreatedRecord(CallJournalRecord &record, const sptr<CallBase> &call)
+{
+    (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+    std::shared_ptr<const CallAttributeInfo> info = call->GetCallAttributeSnapshot();
+    record.eventType = CALL_JOURNAL_EVENT_CREATE;
+    record.callId = info->callId;
+    record.accountId = info->accountId;
+    record.index = (info->callType == CallType::TYPE_OTT) ? 0 : call->GetCallIndex();
+    record.callType = static_cast<int32_t>(info->callType);
+    record.callDirection = static_cast<int32_t>(info->callDirection);
+    record.videoState = static_cast<int32_t>(info->videoState);
+    record.callState = static_cast<int32_t>(info->callState);
+    record.conferenceState = static_cast<int32_t>(info->conferenceState);
+    record.isEcc = info->isEcc ? 1 : 0;
+    (void)memcpy_s(record.accountNumber, kMaxNumberLen, info->accountNumber, kMaxNumberLen);
+    (void)memcpy_s(record.bundleName, kMaxBundleNameLen, info->bundleName, kMaxBundleNameLen);
+}
+
+void CallStateJournal::FillCallStateRecord(CallJournalRecord &record, const sptr<CallBase> &call)
+{
+    // only the states are replayed from this event, they are read without taking the lock of the call
+    (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+    record.eventType = CALL_JOURNAL_EVENT_STATE_CHANGE;
+    record.callId = call->GetCallID();
+    record.videoState = static_cast<int32_t>(call->GetVideoStateType());
+    record.callState = static_cast<int32_t>(call->GetTelCallState());
+    record.conferenceState = static_cast<int32_t>(call->GetTelConferenceState());
+}
+
+void CallStateJournal::FillCallDestroyedRecord(CallJournalRecord &record, int32_t callId)
+{
+    (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+    record.eventType = CALL_JOURNAL_EVENT_DESTROY;
+    record.callId = callId;
+}
+
+void CallStateJournal::Append(CallJournalRecord &record, std::unique_lock<std::mutex> &orderLock)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (orderLock.owns_lock()) {
+        orderLock.unlock();
+    }
+    AppendLocked(record);
+    if (record.eventType == CALL_JOURNAL_EVENT_DESTROY) {
+        ClearCallNumberLocked(record.callId);
+    }
+}
+
+void CallStateJournal::RecordConferenceStateChanged(int32_t callId, TelConferenceState state)
+{
+    CallJournalRecord record;
+    (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+    record.eventType = CALL_JOURNAL_EVENT_CONFERENCE_CHANGE;
+    record.callId = callId;
+    record.conferenceState = static_cast<int32_t>(state);
+    std::lock_guard<std::mutex> lock(mutex_);
+    AppendLocked(record);
+}
+
+int64_t CallStateJournal::GetRecoveryTime()
+{
+    return recoveryTime_;
+}
+
+int32_t CallStateJournal::GetRecoveredCallNum()
+{
+    return recoveredCallNum_;
+}
+
+void CallStateJournal::AppendLocked(CallJournalRecord &record)
+{
+    if (header_ == nullptr) {
+        return;
+    }
+    if (header_->recordNum >= CALL_JOURNAL_RECORD_NUM) {
+        Compact();
+    }
+    if (header_->recordNum >= CALL_JOURNAL_RECORD_NUM) {
+        TELEPHONY_LOGE("call journal is full, drop event:%{public}u", record.eventType);
+        return;
+    }
+    CallJournalRecord &slot = records_[header_->recordNum];
+    record.magic = 0;
+    if (memcpy_s(&slot, sizeof(CallJournalRecord), &record, sizeof(CallJournalRecord)) != EOK) {
+        return;
+    }
+    // the magic is set after the payload and the count after the magic, a torn append is never replayed
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.magic = CALL_JOURNAL_RECORD_MAGIC;
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->updateTime = GetBootTime();
+    ++header_->recordNum;
+}
+
+void CallStateJournal::Compact()
+{
+    std::vector<CallJournalRecord> callRecords;
+    ReplayLocked(callRecords);
+    ResetLocked();
+    for (CallJournalRecord &record : callRecords) {
+        record.eventType = CALL_JOURNAL_EVENT_CREATE;
+        if (memcpy_s(&records_[header_->recordNum], sizeof(CallJournalRecord), &record, sizeof(CallJournalRecord)) !=
+            EOK) {
+            break;
+        }
+        ++header_->recordNum;
+    }
+    TELEPHONY_LOGI("call journal compacted to %{public}u records", header_->recordNum);
+}
+
+// the number is the only personal data in the journal, it is not kept after the call is gone
+void CallStateJournal::ClearCallNumberLocked(int32_t callId)
+{
+    if (header_ == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < header_->recordNum; ++i) {
+        CallJournalRecord &record = records_[i];
+        if (record.callId == callId && record.eventType == CALL_JOURNAL_EVENT_CREATE) {
+            (void)memset_s(record.accountNumber, sizeof(record.accountNumber), 0, sizeof(record.accountNumber));
+        }
+    }
+}
+
+void CallStateJournal::ResetLocked()
+{
+    // the records dropped still hold numbers, they are wiped and not only forgotten
+    (void)memset_s(records_, sizeof(CallJournalRecord) * CALL_JOURNAL_RECORD_NUM, 0,
+        sizeof(CallJournalRecord) * CALL_JOURNAL_RECORD_NUM);
+    header_->magic = CALL_JOURNAL_MAGIC;
+    header_->version = CALL_JOURNAL_VERSION;
+    header_->recordNum = 0;
+    header_->updateTime = GetBootTime();
+}
+
+// folds the journal into the latest record of every call that was not destroyed, in creation order
+void CallStateJournal::ReplayLocked(std::vector<CallJournalRecord> &callRecords)
+{
+    callRecords.clear();
+    for (uint32_t i = 0; i < header_->recordNum; ++i) {
+        const CallJournalRecord &record = records_[i];
+        if (!IsValidRecord(record)) {
+            TELEPHONY_LOGW("invalid call journal record:%{public}u, stop replay", i);
+            break;
+        }
+        auto iter = callRecords.begin();
+        while (iter != callRecords.end() && iter->callId != record.callId) {
+            ++iter;
+        }
+        switch (record.eventType) {
+            case CALL_JOURNAL_EVENT_CREATE:
+                if (iter == callRecords.end()) {
+                    callRecords.emplace_back(record);
+                } else {
+                    *iter = record;
+                }
+                break;
+            case CALL_JOURNAL_EVENT_STATE_CHANGE:
+                if (iter != callRecords.end()) {
+                    iter->videoState = record.videoState;
+                    iter->callState = record.callState;
+                    iter->conferenceState = record.conferenceState;
+                }
+                break;
+            case CALL_JOURNAL_EVENT_CONFERENCE_CHANGE:
+                if (iter != callRecords.end()) {
+                    iter->conferenceState = record.conferenceState;
+                }
+                break;
+            case CALL_JOURNAL_EVENT_DESTROY:
+                if (iter != callRecords.end()) {
+                    callRecords.erase(iter);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+bool CallStateJournal::IsValidRecord(const CallJournalRecord &record)
+{
+    if (record.magic != CALL_JOURNAL_RECORD_MAGIC || record.callId <= CALL_START_ID ||
+        record.callId >= CALL_ID_SPACE_SIZE) {
+        return false;
+    }
+    if (record.eventType < CALL_JOURNAL_EVENT_CREATE || record.eventType > CALL_JOURNAL_EVENT_DESTROY) {
+        return false;
+    }
+    return record.callState >= static_cast<int32_t>(TelCallState::CALL_STATUS_ACTIVE) &&
+        record.callState <= static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE) &&
+        record.conferenceState >= static_cast<int32_t>(TelConferenceState::TEL_CONFERENCE_IDLE) &&
+        record.conferenceState <= static_cast<int32_t>(TelConferenceState::TEL_CONFERENCE_DISCONNECTED);
+}
+
+sptr<CallBase> CallStateJournal::RestoreCall(const CallJournalRecord &record)
+{
+    TelCallState callState = static_cast<TelCallState>(record.callState);
+    if (callState == TelCallState::CALL_STATUS_DISCONNECTED || callState == TelCallState::CALL_STATUS_IDLE) {
+        return nullptr;
+    }
+    if (!CallObjectManager::ReserveCallId(record.callId)) {
+        return nullptr;
+    }
+    DialParaInfo info;
+    info.callId = record.callId;
+    info.accountId = record.accountId;
+    info.index = record.index;
+    info.callType = static_cast<CallType>(record.callType);
+    info.videoState = static_cast<VideoStateType>(record.videoState);
+    info.isEcc = record.isEcc != 0;
+    info.number = std::string(record.accountNumber, strnlen(record.accountNumber, kMaxNumberLen));
+    info.bundleName = std::string(record.bundleName, strnlen(record.bundleName, kMaxBundleNameLen));
+    // the call starts from idle so that setting the journaled state below derives the running state as well
+    info.callState = TelCallState::CALL_STATUS_IDLE;
+    bool isOutgoing = static_cast<CallDirection>(record.callDirection) == CallDirection::CALL_DIRECTION_OUT;
+    AppExecFwk::PacMap extras;
+    extras.Clear();
+    sptr<CallBase> call = nullptr;
+    switch (info.callType) {
+        case CallType::TYPE_CS:
+            call = isOutgoing ? (std::make_unique<CSCall>(info, extras)).release() :
+                                (std::make_unique<CSCall>(info)).release();
+            break;
+        case CallType::TYPE_IMS:
+            call = isOutgoing ? (std::make_unique<IMSCall>(info, extras)).release() :
+                                (std::make_unique<IMSCall>(info)).release();
+            break;
+        case CallType::TYPE_OTT:
+            call = isOutgoing ? (std::make_unique<OTTCall>(info, extras)).release() :
+                                (std::make_unique<OTTCall>(info)).release();
+            break;
+        default:
+            break;
+    }
+    if (call == nullptr || CallObjectManager::AddOneCallObject(call) != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("restore call failed, callId:%{public}d", record.callId);
+        CallObjectManager::RecycleCallId(record.callId);
+        return nullptr;
+    }
+    call->SetTelCallState(callState);
+    call->SetTelConferenceState(static_cast<TelConferenceState>(record.conferenceState));
+    return call;
+}
+
+int64_t CallStateJournal::GetBootTime()
+{
+    struct timespec bootTime = {0};
+    if (clock_gettime(CLOCK_BOOTTIME, &bootTime) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(bootTime.tv_sec) * MILLISECONDS_PER_SECOND +
+        static_cast<int64_t>(bootTime.tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -17,29 +17,36 @@
 
 #include "telephony_log_wrapper.h"
 
+#include "call_latency_tracer.h"
+#include "call_perf_statistics.h"
+
 namespace OHOS {
 namespace Telephony {
-CallStateListener::CallStateListener()
+CallStateListener::CallStateListener() : listenerSet_(std::make_shared<const ObserverSet>())
 {
-    listenerSet_.clear();
+    observerExecutor_.Start();
 }
 
 CallStateListener::~CallStateListener()
 {
-    listenerSet_.clear();
+    std::atomic_store(&listenerSet_, std::shared_ptr<const ObserverSet>());
 }
 
-bool CallStateListener::AddOneObserver(const sptr<CallStateListenerBase> &observer)
+bool CallStateListener::AddOneObserver(const sptr<CallStateListenerBase> &observer, CallObserverPriority priority)
 {
     if (observer == nullptr) {
         TELEPHONY_LOGE("observer is nullptr!");
         return false;
     }
     std::lock_guard<std::mutex> lock(mutex_);
-    if (listenerSet_.count(observer) > 0) {
+    std::shared_ptr<const ObserverSet> observerSet = GetObserverSnapshot();
+    if (observerSet != nullptr && observerSet->count(observer) > 0) {
         return true;
     }
-    listenerSet_.insert(observer);
+    auto newObserverSet =
+        (observerSet == nullptr) ? std::make_shared<ObserverSet>() : std::make_shared<ObserverSet>(*observerSet);
+    newObserverSet->emplace(observer, priority);
+    PublishObserverSet(newObserverSet);
     return true;
 }
 
@@ -50,35 +57,65 @@ bool CallStateListener::RemoveOneObserver(const sptr<CallStateListenerBase> &obs
         return false;
     }
     std::lock_guard<std::mutex> lock(mutex_);
-    listenerSet_.erase(observer);
+    std::shared_ptr<const ObserverSet> observerSet = GetObserverSnapshot();
+    if (observerSet == nullptr || observerSet->count(observer) == 0) {
+        return true;
+    }
+    auto newObserverSet = std::make_shared<ObserverSet>(*observerSet);
+    newObserverSet->erase(observer);
+    PublishObserverSet(newObserverSet);
+    observerExecutor_.RemoveObserver(observer);
     return true;
 }
 
 bool CallStateListener::RemoveAllObserver()
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    listenerSet_.clear();
+    PublishObserverSet(std::make_shared<ObserverSet>());
     return true;
 }
 
+template<typename Function>
+void CallStateListener::Dispatch(Function function)
+{
+    std::shared_ptr<const ObserverSet> observerSet = GetObserverSnapshot();
+    if (observerSet == nullptr) {
+        return;
+    }
+    // best-effort observers are queued first so that they run while the critical ones are called here
+    for (auto &observerPair : *observerSet) {
+        if (observerPair.second == CALL_OBSERVER_PRIORITY_BEST_EFFORT) {
+            sptr<CallStateListenerBase> observer = observerPair.first;
+            observerExecutor_.Execute(observer, [function, observer]() mutable {
+                CallPerfTimer timer(CALL_PERF_TIMER_BEST_EFFORT_OBSERVER);
+                function(observer);
+            });
+        }
+    }
+    for (auto &observerPair : *observerSet) {
+        if (observerPair.second == CALL_OBSERVER_PRIORITY_CRITICAL) {
+            CallPerfTimer timer(CALL_PERF_TIMER_CRITICAL_OBSERVER);
+            function(observerPair.first);
+        }
+    }
+}
+
 void CallStateListener::NewCallCreated(sptr<CallBase> &callObjectPtr)
 {
     if (callObjectPtr == nullptr) {
         TELEPHONY_LOGE("callObjectPtr is nullptr!");
         return;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->NewCallCreated(callObjectPtr);
-    }
+    sptr<CallBase> call = callObjectPtr;
+    std::shared_ptr<const CallAttributeInfo> info = call->GetCallAttributeSnapshot();
+    Dispatch([call, info](const sptr<CallStateListenerBase> &observer) mutable {
+        observer->NewCallSnapshotCreated(call, *info);
+    });
 }
 
 void CallStateListener::CallDestroyed(int32_t cause)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->CallDestroyed(cause);
-    }
+    Dispatch([cause](const sptr<CallStateListenerBase> &observer) { observer->CallDestroyed(cause); });
 }
 
 void CallStateListener::CallStateUpdated(
@@ -88,10 +125,12 @@ void CallStateListener::CallStateUpdated(
         TELEPHONY_LOGE("callObjectPtr is nullptr");
         return;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->CallStateUpdated(callObjectPtr, priorState, nextState);
-    }
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_REPORT_HANDLE);
+    sptr<CallBase> call = callObjectPtr;
+    std::shared_ptr<const CallAttributeInfo> info = call->GetCallAttributeSnapshot();
+    Dispatch([call, info, priorState, nextState](const sptr<CallStateListenerBase> &observer) mutable {
+        observer->CallSnapshotUpdated(call, *info, priorState, nextState);
+    });
 }
 
 void CallStateListener::IncomingCallHungUp(sptr<CallBase> &callObjectPtr, bool isSendSms, std::string content)
@@ -100,10 +139,10 @@ void CallStateListener::IncomingCallHungUp(sptr<CallBase> &callObjectPtr, bool i
         TELEPHONY_LOGE("callObjectPtr is nullptr");
         return;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->IncomingCallHungUp(callObjectPtr, isSendSms, content);
-    }
+    sptr<CallBase> call = callObjectPtr;
+    Dispatch([call, isSendSms, content](const sptr<CallStateListenerBase> &observer) mutable {
+        observer->IncomingCallHungUp(call, isSendSms, content);
+    });
 }
 
 void CallStateListener::IncomingCallActivated(sptr<CallBase> &callObjectPtr)
@@ -112,18 +151,26 @@ void CallStateListener::IncomingCallActivated(sptr<CallBase> &callObjectPtr)
         TELEPHONY_LOGE("callObjectPtr is nullptr");
         return;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->IncomingCallActivated(callObjectPtr);
-    }
+    sptr<CallBase> call = callObjectPtr;
+    Dispatch([call](const sptr<CallStateListenerBase> &observer) mutable { observer->IncomingCallActivated(call); });
 }
 
 void CallStateListener::CallEventUpdated(CallEventInfo &info)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &observer : listenerSet_) {
-        observer->CallEventUpdated(info);
-    }
+    CallEventInfo eventInfo = info;
+    Dispatch([eventInfo](const sptr<CallStateListenerBase> &observer) mutable {
+        observer->CallEventUpdated(eventInfo);
+    });
+}
+
+std::shared_ptr<const CallStateListener::ObserverSet> CallStateListener::GetObserverSnapshot()
+{
+    return std::atomic_load(&listenerSet_);
+}
+
+void CallStateListener::PublishObserverSet(const std::shared_ptr<ObserverSet> &observerSet)
+{
+    std::atomic_store(&listenerSet_, std::shared_ptr<const ObserverSet>(observerSet));
 }
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
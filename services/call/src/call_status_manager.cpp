@@ -26,13 +26,13 @@
 #include "ott_call.h"
 #include "audio_control_manager.h"
 #include "call_control_manager.h"
+#include "cellular_call_connection.h"
 
 namespace OHOS {
 namespace Telephony {
-CallStatusManager::CallStatusManager()
+CallStatusManager::CallStatusManager() : reportSequence_(0)
 {
     (void)memset_s(&callReportInfo_, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
-    (void)memset_s(&callDetailsInfo_, sizeof(CallDetailsInfo), 0, sizeof(CallDetailsInfo));
 }
 
 CallStatusManager::~CallStatusManager()
@@ -42,7 +42,7 @@ CallStatusManager::~CallStatusManager()
 
 int32_t CallStatusManager::Init()
 {
-    callDetailsInfo_.callVec.clear();
+    reportedCallMap_.clear();
     mEventIdTransferMap_.clear();
     mOttEventIdTransferMap_.clear();
     InitCallBaseEvent();
@@ -59,7 +59,7 @@ void CallStatusManager::InitCallBaseEvent()
 
 int32_t CallStatusManager::UnInit()
 {
-    callDetailsInfo_.callVec.clear();
+    reportedCallMap_.clear();
     mEventIdTransferMap_.clear();
     mOttEventIdTransferMap_.clear();
     return TELEPHONY_SUCCESS;
@@ -104,45 +104,98 @@ int32_t CallStatusManager::HandleCallReportInfo(const CallDetailInfo &info)
 // handle call state changes, incoming call, outgoing call.
 int32_t CallStatusManager::HandleCallsReportInfo(const CallDetailsInfo &info)
 {
-    bool flag = false;
     TELEPHONY_LOGI("call list size:%{public}zu,slotId:%{public}d", info.callVec.size(), info.slotId);
-    for (auto &it : info.callVec) {
-        for (auto &it1 : callDetailsInfo_.callVec) {
-            if (strcmp(it.phoneNum, it1.phoneNum) == 0) {
-                // call state changes
-                if (it.state != it1.state) {
-                    TELEPHONY_LOGI("handle updated call state:%{public}d", it.state);
-                    HandleCallReportInfo(it);
-                }
-                flag = true;
+    std::vector<CallReportChange> changes;
+    DiffCallsReportInfo(info, changes);
+    for (auto &it : changes) {
+        switch (it.type) {
+            case CALL_REPORT_CREATED:
+                // incoming/outgoing call handle
+                TELEPHONY_LOGI("handle new call state:%{public}d", it.info.state);
                 break;
-            }
+            case CALL_REPORT_CHANGED:
+                TELEPHONY_LOGI("handle updated call state:%{public}d", it.info.state);
+                break;
+            default:
+                TELEPHONY_LOGI("handle vanished call, index:%{public}d", it.info.index);
+                break;
+        }
+        HandleCallReportInfo(it.info);
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+/**
+ * compares a call list report with the previous one of the same slot, calls are matched by their index.
+ * Created and changed calls are listed in report order followed by the calls that are gone, which are
+ * marked disconnected. A call whose index now carries another number is handled as vanished and created again.
+ */
+void CallStatusManager::DiffCallsReportInfo(const CallDetailsInfo &info, std::vector<CallReportChange> &changes)
+{
+    auto slotIter = reportedCallMap_.find(info.slotId);
+    if (slotIter == reportedCallMap_.end()) {
+        slotIter = reportedCallMap_.emplace(info.slotId, ReportedCallMap()).first;
+        SeedReportedCalls(info.slotId, slotIter->second);
+    }
+    ReportedCallMap &reportedCalls = slotIter->second;
+    uint64_t sequence = ++reportSequence_;
+    for (auto &it : info.callVec) {
+        auto iter = reportedCalls.find(it.index);
+        if (iter != reportedCalls.end() && strcmp(it.phoneNum, iter->second.info.phoneNum) != 0) {
+            iter->second.info.state = TelCallState::CALL_STATUS_DISCONNECTED;
+            changes.push_back({ CALL_REPORT_VANISHED, iter->second.info });
+            reportedCalls.erase(iter);
+            iter = reportedCalls.end();
         }
-        // incoming/outgoing call handle
-        if (!flag || callDetailsInfo_.callVec.empty()) {
-            TELEPHONY_LOGI("handle new call state:%{public}d", it.state);
-            HandleCallReportInfo(it);
+        if (iter == reportedCalls.end()) {
+            changes.push_back({ CALL_REPORT_CREATED, it });
+            reportedCalls[it.index] = { it, sequence };
+            continue;
         }
-        flag = false;
-    }
-    // disconnected calls handle
-    for (auto &it2 : callDetailsInfo_.callVec) {
-        for (auto &it3 : info.callVec) {
-            if (strcmp(it2.phoneNum, it3.phoneNum) == 0) {
-                TELEPHONY_LOGI("state:%{public}d", it2.state);
-                flag = true;
-                break;
-            }
+        if (it.state != iter->second.info.state) {
+            changes.push_back({ CALL_REPORT_CHANGED, it });
         }
-        if (!flag) {
-            it2.state = TelCallState::CALL_STATUS_DISCONNECTED;
-            HandleCallReportInfo(it2);
+        iter->second.info = it;
+        iter->second.reportSequence = sequence;
+    }
+    for (auto iter = reportedCalls.begin(); iter != reportedCalls.end();) {
+        if (iter->second.reportSequence == sequence) {
+            ++iter;
+            continue;
         }
-        flag = false;
+        iter->second.info.state = TelCallState::CALL_STATUS_DISCONNECTED;
+        changes.push_back({ CALL_REPORT_VANISHED, iter->second.info });
+        iter = reportedCalls.erase(iter);
+    }
+}
+
+/**
+ * the calls that exist before the first list report of a slot, such as those the call state journal recovered
+ * after the service restarted, are taken as reported, so one that ended meanwhile is marked disconnected.
+ */
+void CallStatusManager::SeedReportedCalls(int32_t slotId, ReportedCallMap &reportedCalls)
+{
+    std::list<sptr<CallBase>> callList;
+    GetAllCallList(callList);
+    CallDetailInfo info;
+    for (auto &call : callList) {
+        if (call->GetCallType() == CallType::TYPE_OTT || call->GetSlotId() != slotId) {
+            continue;
+        }
+        (void)memset_s(&info, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
+        std::string number = call->GetAccountNumber();
+        if (memcpy_s(info.phoneNum, kMaxNumberLen, number.c_str(), number.length()) != EOK) {
+            TELEPHONY_LOGE("memcpy_s failed!");
+            continue;
+        }
+        info.index = call->GetCallIndex();
+        info.accountId = slotId;
+        info.callType = call->GetCallType();
+        info.callMode = call->GetVideoStateType();
+        info.state = call->GetTelCallState();
+        reportedCalls[info.index] = { info, reportSequence_ };
+        TELEPHONY_LOGI("seeded reported call, slotId:%{public}d, index:%{public}d", slotId, info.index);
     }
-    callDetailsInfo_.callVec.clear();
-    callDetailsInfo_ = info;
-    return TELEPHONY_SUCCESS;
 }
 
 int32_t CallStatusManager::HandleDisconnectedCause(int32_t cause)
@@ -305,8 +358,7 @@ int32_t CallStatusManager::DialingHandle(const CallDetailInfo &info)
 int32_t CallStatusManager::ActiveHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle active state");
-    std::string tmpStr(info.phoneNum);
-    sptr<CallBase> call = GetOneCallObject(tmpStr);
+    sptr<CallBase> call = GetReportedCallObject(info);
     if (call == nullptr) {
         TELEPHONY_LOGE("Call is NULL");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -336,8 +388,7 @@ int32_t CallStatusManager::ActiveHandle(const CallDetailInfo &info)
 int32_t CallStatusManager::HoldingHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle holding state");
-    std::string tmpStr(info.phoneNum);
-    sptr<CallBase> call = GetOneCallObject(tmpStr);
+    sptr<CallBase> call = GetReportedCallObject(info);
     if (call == nullptr) {
         TELEPHONY_LOGE("Call is NULL");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -362,8 +413,7 @@ int32_t CallStatusManager::WaitingHandle(const CallDetailInfo &info)
 int32_t CallStatusManager::AlertHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle alerting state");
-    std::string tmpStr(info.phoneNum);
-    sptr<CallBase> call = GetOneCallObject(tmpStr);
+    sptr<CallBase> call = GetReportedCallObject(info);
     if (call == nullptr) {
         TELEPHONY_LOGE("Call is NULL");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -384,8 +434,7 @@ int32_t CallStatusManager::AlertHandle(const CallDetailInfo &info)
 int32_t CallStatusManager::DisconnectingHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle disconnecting state");
-    std::string tmpStr(info.phoneNum);
-    sptr<CallBase> call = GetOneCallObject(tmpStr);
+    sptr<CallBase> call = GetReportedCallObject(info);
     if (call == nullptr) {
         TELEPHONY_LOGE("Call is NULL");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -400,8 +449,7 @@ int32_t CallStatusManager::DisconnectingHandle(const CallDetailInfo &info)
 int32_t CallStatusManager::DisconnectedHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle disconnected state");
-    std::string tmpStr(info.phoneNum);
-    sptr<CallBase> call = GetOneCallObject(tmpStr);
+    sptr<CallBase> call = GetReportedCallObject(info);
     if (call == nullptr) {
         TELEPHONY_LOGE("Call is NULL");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -416,9 +464,23 @@ int32_t CallStatusManager::DisconnectedHandle(const CallDetailInfo &info)
         return ret;
     }
     DeleteOneCallObject(call->GetCallID());
+    DelayedSingleton<CellularCallConnection>::GetInstance()->ClearDtmfString(call->GetCallID());
     return ret;
 }
 
+// the same number may be in a call on both slots, carrier calls are found by the slot and index the modem reports
+sptr<CallBase> CallStatusManager::GetReportedCallObject(const CallDetailInfo &info)
+{
+    if (info.callType == CallType::TYPE_CS || info.callType == CallType::TYPE_IMS) {
+        sptr<CallBase> call = GetOneCallObject(info.accountId, info.index);
+        if (call != nullptr) {
+            return call;
+        }
+    }
+    std::string tmpStr(info.phoneNum);
+    return GetOneCallObject(tmpStr);
+}
+
 int32_t CallStatusManager::UpdateCallState(sptr<CallBase> &call, TelCallState nextState)
 {
     TELEPHONY_LOGI("UpdateCallState start");
@@ -478,6 +540,10 @@ sptr<CallBase> CallStatusManager::CreateNewCall(const CallDetailInfo &info, Call
     AppExecFwk::PacMap extras;
     extras.Clear();
     PackParaInfo(paraInfo, info, dir, extras);
+    if (paraInfo.callId == ERR_ID) {
+        TELEPHONY_LOGE("no call id available!");
+        return nullptr;
+    }
     switch (info.callType) {
         case CallType::TYPE_CS: {
             if (dir == CallDirection::CALL_DIRECTION_OUT) {
@@ -504,10 +570,12 @@ sptr<CallBase> CallStatusManager::CreateNewCall(const CallDetailInfo &info, Call
             break;
         }
         default:
+            RecycleCallId(paraInfo.callId);
             return nullptr;
     }
     if (callPtr == nullptr) {
         TELEPHONY_LOGE("CreateNewCall failed!");
+        RecycleCallId(paraInfo.callId);
         return nullptr;
     }
     AddOneCallObject(callPtr);
@@ -200,6 +200,11 @@ int32_t CarrierCall::GetSlotId()
     return slotId_;
 }
 
+int32_t CarrierCall::GetCallIndex()
+{
+    return index_;
+}
+
 int32_t CarrierCall::CarrierCombineConference()
 {
     CellularCallInfo callInfo;
@@ -238,7 +243,7 @@ int32_t CarrierCall::PackCellularCallInfo(CellularCallInfo &callInfo)
 {
     callInfo.callId = callId_;
     callInfo.callType = callType_;
-    callInfo.videoState = static_cast<int32_t>(videoState_);
+    callInfo.videoState = static_cast<int32_t>(GetVideoStateType());
     callInfo.index = index_;
     callInfo.slotId = slotId_;
     callInfo.accountId = slotId_;
@@ -280,5 +285,19 @@ int32_t CarrierCall::StopDtmf()
     }
     return cellularCallConnectionPtr_->StopDtmf(callInfo);
 }
+
+int32_t CarrierCall::SendDtmfString(const std::string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    CellularCallInfo callInfo;
+    int32_t ret = PackCellularCallInfo(callInfo);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGW("PackCellularCallInfo failed!");
+    }
+    if (cellularCallConnectionPtr_ == nullptr) {
+        TELEPHONY_LOGE("cellularCallConnectionPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    return cellularCallConnectionPtr_->SendDtmfString(dtmfString, callInfo, onLength, offLength);
+}
 } // namespace Telephony
 } // namespace OHOS
@@ -26,13 +26,13 @@ namespace Telephony {
 ConferenceBase::ConferenceBase()
     : mainCallId_(ERR_ID), state_(CONFERENCE_STATE_IDLE), beginTime_(0), conferenceType_(CallType::TYPE_CS)
 {
-    subCallIdSet_.clear();
+    subCallIdSet_.reset();
 }
 
 ConferenceBase::~ConferenceBase()
 {
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    subCallIdSet_.clear();
+    subCallIdSet_.reset();
 }
 
 int32_t ConferenceBase::GetMainCall()
@@ -76,12 +76,15 @@ std::vector<std::u16string> ConferenceBase::GetSubCallIdList(int32_t callId)
     bool flag = false;
     vec.clear();
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    for (auto it = subCallIdSet_.begin(); it != subCallIdSet_.end(); ++it) {
-        if (*it == callId) {
+    for (int32_t subCallId = CALL_START_ID + 1; subCallId < CALL_ID_SPACE_SIZE; ++subCallId) {
+        if (!subCallIdSet_.test(subCallId)) {
+            continue;
+        }
+        if (subCallId == callId) {
             flag = true;
         }
-        vec.push_back(Str8ToStr16(std::to_string(*it)));
-        TELEPHONY_LOGI("subCallId_:%{public}d", *it);
+        vec.push_back(Str8ToStr16(std::to_string(subCallId)));
+        TELEPHONY_LOGI("subCallId_:%{public}d", subCallId);
     }
     if (!flag) {
         vec.clear();
@@ -96,12 +99,15 @@ std::vector<std::u16string> ConferenceBase::GetCallIdListForConference(int32_t c
     bool flag = false;
     vec.clear();
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    for (auto it = subCallIdSet_.begin(); it != subCallIdSet_.end(); ++it) {
-        if (*it == callId) {
+    for (int32_t subCallId = CALL_START_ID + 1; subCallId < CALL_ID_SPACE_SIZE; ++subCallId) {
+        if (!subCallIdSet_.test(subCallId)) {
+            continue;
+        }
+        if (subCallId == callId) {
             flag = true;
         }
-        vec.push_back(Str8ToStr16(std::to_string(*it)));
-        TELEPHONY_LOGI("subCallId_:%{public}d", *it);
+        vec.push_back(Str8ToStr16(std::to_string(subCallId)));
+        TELEPHONY_LOGI("subCallId_:%{public}d", subCallId);
     }
     if (mainCallId_ == callId) {
         flag = true;
@@ -113,5 +119,13 @@ std::vector<std::u16string> ConferenceBase::GetCallIdListForConference(int32_t c
     }
     return vec;
 }
+
+bool ConferenceBase::IsSubCallId(int32_t callId)
+{
+    if (callId <= CALL_START_ID || callId >= CALL_ID_SPACE_SIZE) {
+        return false;
+    }
+    return subCallIdSet_.test(callId);
+}
 } // namespace Telephony
 } // namespace OHOS
@@ -47,11 +47,15 @@ int32_t CsConference::JoinToConference(int32_t callId)
         TELEPHONY_LOGE("the current conference status does not allow CombineConference");
         return CALL_ERR_ILLEGAL_CALL_OPERATION;
     }
-    if (subCallIdSet_.size() >= maxSubCallLimits_) {
-        TELEPHONY_LOGE("already %{public}zu calls in the conference, exceed limits!", subCallIdSet_.size());
+    if (subCallIdSet_.count() >= maxSubCallLimits_) {
+        TELEPHONY_LOGE("already %{public}zu calls in the conference, exceed limits!", subCallIdSet_.count());
         return CALL_ERR_CONFERENCE_CALL_EXCEED_LIMIT;
     }
-    subCallIdSet_.insert(callId);
+    if (callId <= CALL_START_ID || callId >= CALL_ID_SPACE_SIZE) {
+        TELEPHONY_LOGE("callId is invalid:%{public}d", callId);
+        return CALL_ERR_INVALID_CALLID;
+    }
+    subCallIdSet_.set(callId);
     state_ = CONFERENCE_STATE_ACTIVE;
     beginTime_ = time(nullptr);
     return TELEPHONY_SUCCESS;
@@ -60,13 +64,13 @@ int32_t CsConference::JoinToConference(int32_t callId)
 int32_t CsConference::LeaveFromConference(int32_t callId)
 {
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    if (subCallIdSet_.find(callId) != subCallIdSet_.end()) {
-        subCallIdSet_.erase(callId);
+    if (IsSubCallId(callId)) {
+        subCallIdSet_.reset(callId);
     } else {
         TELEPHONY_LOGE("leave conference failed, callId %{public}d not in conference", callId);
         return CALL_ERR_CONFERENCE_SEPERATE_FAILED;
     }
-    if (subCallIdSet_.empty()) {
+    if (subCallIdSet_.none()) {
         mainCallId_ = ERR_ID;
         state_ = CONFERENCE_STATE_IDLE;
         beginTime_ = 0;
@@ -81,13 +85,13 @@ int32_t CsConference::HoldConference(int32_t callId)
         TELEPHONY_LOGI("HoldConference success");
         return TELEPHONY_SUCCESS;
     }
-    if (subCallIdSet_.find(callId) != subCallIdSet_.end()) {
-        subCallIdSet_.erase(callId);
+    if (IsSubCallId(callId)) {
+        subCallIdSet_.reset(callId);
     } else {
         TELEPHONY_LOGE("separate conference failed, callId %{public}d not in conference", callId);
         return CALL_ERR_CONFERENCE_SEPERATE_FAILED;
     }
-    if (subCallIdSet_.empty()) {
+    if (subCallIdSet_.none()) {
         mainCallId_ = ERR_ID;
         state_ = CONFERENCE_STATE_IDLE;
         beginTime_ = 0;
@@ -98,8 +102,8 @@ int32_t CsConference::HoldConference(int32_t callId)
 int32_t CsConference::CanCombineConference()
 {
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    if (subCallIdSet_.size() >= maxSubCallLimits_) {
-        TELEPHONY_LOGE("there is %{public}zu calls in the conference yet!", subCallIdSet_.size());
+    if (subCallIdSet_.count() >= maxSubCallLimits_) {
+        TELEPHONY_LOGE("there is %{public}zu calls in the conference yet!", subCallIdSet_.count());
         return CALL_ERR_CONFERENCE_CALL_EXCEED_LIMIT;
     }
     return TELEPHONY_SUCCESS;
@@ -108,7 +112,7 @@ int32_t CsConference::CanCombineConference()
 int32_t CsConference::CanSeparateConference()
 {
     std::lock_guard<std::mutex> lock(conferenceMutex_);
-    if (subCallIdSet_.empty() || state_ != CONFERENCE_STATE_ACTIVE) {
+    if (subCallIdSet_.none() || state_ != CONFERENCE_STATE_ACTIVE) {
         TELEPHONY_LOGE("no call is currently in the conference!");
         return CALL_ERR_CONFERENCE_NOT_EXISTS;
     }
@@ -170,11 +170,21 @@ int32_t OTTCall::StopDtmf()
     return CALL_ERR_FUNCTION_NOT_SUPPORTED;
 }
 
+int32_t OTTCall::SendDtmfString(const std::string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    return CALL_ERR_FUNCTION_NOT_SUPPORTED;
+}
+
 int32_t OTTCall::GetSlotId()
 {
     return CALL_ERR_ILLEGAL_CALL_OPERATION;
 }
 
+int32_t OTTCall::GetCallIndex()
+{
+    return CALL_ERR_ILLEGAL_CALL_OPERATION;
+}
+
 int32_t OTTCall::CombineConference()
 {
     int32_t ret = DelayedSingleton<OttConference>::GetInstance()->SetMainCall(GetCallID());
@@ -320,7 +330,7 @@ int32_t OTTCall::PackOttCallRequestInfo(OttCallRequestInfo &requestInfo)
         TELEPHONY_LOGW("memset_s failed!");
         return TELEPHONY_ERR_MEMSET_FAIL;
     }
-    requestInfo.videoState = videoState_;
+    requestInfo.videoState = GetVideoStateType();
     return TELEPHONY_SUCCESS;
 }
 } // namespace Telephony
@@ -28,11 +28,12 @@ VideoCallState::VideoCallState(sptr<NetCallBase> callPtr)
 
 bool VideoCallState::IsCallSupportVideoCall()
 {
-    if (call_ == nullptr) {
+    sptr<NetCallBase> call = call_.promote();
+    if (call == nullptr) {
         TELEPHONY_LOGE("unexpect null pointer.");
         return false;
     }
-    sptr<IMSCall> netCall = static_cast<IMSCall *>(call_.GetRefPtr());
+    sptr<IMSCall> netCall = static_cast<IMSCall *>(call.GetRefPtr());
     return netCall->IsSupportVideoCall();
 }
 
@@ -48,40 +49,44 @@ VideoUpdateStatus VideoCallState::GetVideoUpdateStatus()
 
 int32_t VideoCallState::SwitchCallVideoState(ImsCallMode mode)
 {
-    if (call_ == nullptr) {
+    sptr<NetCallBase> call = call_.promote();
+    if (call == nullptr) {
         TELEPHONY_LOGE("unexpect null pointer.");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    sptr<IMSCall> netCall = static_cast<IMSCall *>(call_.GetRefPtr());
+    sptr<IMSCall> netCall = static_cast<IMSCall *>(call.GetRefPtr());
     netCall->SwitchVideoState(mode);
     return TELEPHONY_SUCCESS;
 }
 
 int32_t VideoCallState::DispatchUpdateVideoRequest(ImsCallMode mode)
 {
-    if (call_ == nullptr) {
+    sptr<NetCallBase> call = call_.promote();
+    if (call == nullptr) {
         TELEPHONY_LOGE("unexpect null pointer.");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    return call_->DispatchUpdateVideoRequest(mode);
+    return call->DispatchUpdateVideoRequest(mode);
 }
 
 int32_t VideoCallState::DispatchUpdateVideoResponse(ImsCallMode mode)
 {
-    if (call_ == nullptr) {
+    sptr<NetCallBase> call = call_.promote();
+    if (call == nullptr) {
         TELEPHONY_LOGE("unexpect null pointer.");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    return call_->DispatchUpdateVideoResponse(mode);
+    return call->DispatchUpdateVideoResponse(mode);
 }
 
 sptr<VideoCallState> VideoCallState::GetCallVideoState(ImsCallMode mode)
 {
-    if (call_ == nullptr) {
+    sptr<NetCallBase> call = call_.promote();
+    if (call == nullptr) {
         TELEPHONY_LOGE("unexpect null pointer.");
         return nullptr;
     }
-    sptr<IMSCall> netCall = static_cast<IMSCall *>(call_.GetRefPtr());
+    sptr<IMSCall> netCall = static_cast<IMSCall *>(call.GetRefPtr());
     return netCall->GetCallVideoState(mode);
 }
 
@@ -134,6 +139,7 @@ int32_t AudioOnlyState::RecieveUpdateCallMediaModeRequest(ImsCallMode mode)
     TELEPHONY_LOGI("AudioOnlyState receive update video request. mode:%{public}d", mode);
     int32_t ret = TELEPHONY_SUCCESS;
     VideoUpdateStatus status = GetVideoUpdateStatus();
+    sptr<NetCallBase> call = nullptr;
     switch (mode) {
         case ImsCallMode::CALL_MODE_AUDIO_ONLY:
         case ImsCallMode::CALL_MODE_VIDEO_PAUSED:
@@ -155,9 +161,10 @@ int32_t AudioOnlyState::RecieveUpdateCallMediaModeRequest(ImsCallMode mode)
                 return CALL_ERR_VIDEO_IN_PROGRESS;
             }
             SetVideoUpdateStatus(VideoUpdateStatus::STATUS_RECV_REQUEST);
-            if (call_) {
+            call = call_.promote();
+            if (call != nullptr) {
                 // notify app to accept or refuse, assume always accept here
-                sptr<IMSCall> netCall = static_cast<IMSCall *>(call_.GetRefPtr());
+                sptr<IMSCall> netCall = static_cast<IMSCall *>(call.GetRefPtr());
                 if (netCall == nullptr) {
                     TELEPHONY_LOGE("unexpect null pointer.");
                     return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CALL_IPC_STATISTICS_H
+#define CALL_IPC_STATISTICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "call_latency_tracer.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @ClassName:CallIpcStatistics
+ * @Description:per request code latency histograms of CallManagerServiceStub. Every binder thread
+ * writes to a shard of its own, so recording takes no lock and no shared cache line. The shards
+ * are only merged when the statistics are dumped.
+ */
+class CallIpcStatistics {
+public:
+    CallIpcStatistics();
+    ~CallIpcStatistics();
+    void Init(const std::vector<uint32_t> &codes);
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const;
+    void Record(uint32_t code, int32_t result, int64_t latencyUs);
+    void RecordDescriptorFailure(uint32_t code);
+    void Dump(std::string &result);
+
+private:
+    // written by the thread owning the shard only, atomics let the dump read them while it writes
+    struct CodeHistogram {
+        CallLatencyHistogram latency;
+        std::atomic<uint32_t> errorCount = {0};
+        std::atomic<uint32_t> descriptorFailCount = {0};
+    };
+    struct Shard {
+        explicit Shard(size_t codeNum);
+        ~Shard();
+        size_t codeNum;
+        // made the first time the thread handles the code, most threads only ever see a few codes
+        std::unique_ptr<std::atomic<CodeHistogram *>[]> histograms;
+    };
+    struct MergedHistogram {
+        CallLatencyHistogram latency;
+        uint64_t errorCount = 0;
+        uint64_t descriptorFailCount = 0;
+    };
+    CodeHistogram *GetLocalHistogram(uint32_t code);
+    Shard *GetLocalShard();
+    void MergeHistogram(size_t codeIndex, MergedHistogram &merged);
+    static void Increase(std::atomic<uint32_t> &counter);
+
+    uint64_t instanceId_;
+    std::atomic<bool> isEnabled_;
+    std::atomic<uint64_t> unknownCodeNum_;
+    std::map<uint32_t, size_t> codeIndexMap_;
+    std::mutex shardMutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_IPC_STATISTICS_H
@@ -33,6 +33,10 @@ private:
     void ShowHelp(std::string &result) const;
 
     void ShowCallManagerInfo(std::string &result) const;
+
+    void ShowPerfInfo(std::string &result) const;
+
+    void SetCallReportCoalesceWindow(const std::string &arg, std::string &result) const;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -16,41 +16,41 @@
 #ifndef CALL_MANAGER_SERVICE_STUB_H
 #define CALL_MANAGER_SERVICE_STUB_H
 
-#include <map>
+#include <string>
 
 #include "iremote_object.h"
 #include "iremote_stub.h"
 
+#include "call_dispatch_table.h"
+#include "call_ipc_statistics.h"
 #include "i_call_manager_service.h"
 
 namespace OHOS {
 namespace Telephony {
+constexpr uint32_t CALL_MANAGER_SURFACE_CODE_NUM = INTERFACE_SEND_DTMF_STRING + 1;
+
 class CallManagerServiceStub : public IRemoteStub<ICallManagerService> {
 public:
     CallManagerServiceStub();
     ~CallManagerServiceStub();
     virtual int32_t OnRemoteRequest(
         uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
+    void DumpIpcStatistics(std::string &result);
+    void SetIpcStatisticsEnabled(bool enabled);
 
 private:
     using CallManagerServiceFunc = int32_t (CallManagerServiceStub::*)(MessageParcel &data, MessageParcel &reply);
 
-    void InitCallBasicRequest();
-    void InitCallUtilsRequest();
-    void InitCallConferenceRequest();
-    void InitCallDtmfRequest();
-    void InitCallSupplementRequest();
-    void initCallConferenceExRequest();
-    void InitCallMultimediaRequest();
-    void InitImsServiceRequest();
-    void InitOttServiceRequest();
-
     int32_t OnRegisterCallBack(MessageParcel &data, MessageParcel &reply);
     int32_t OnUnRegisterCallBack(MessageParcel &data, MessageParcel &reply);
     int32_t OnDialCall(MessageParcel &data, MessageParcel &reply);
     int32_t OnAcceptCall(MessageParcel &data, MessageParcel &reply);
     int32_t OnRejectCall(MessageParcel &data, MessageParcel &reply);
     int32_t OnHangUpCall(MessageParcel &data, MessageParcel &reply);
+    int32_t OnAnswerAndHoldActiveCall(MessageParcel &data, MessageParcel &reply);
+    int32_t OnAnswerAndEndActiveCall(MessageParcel &data, MessageParcel &reply);
+    int32_t OnHangUpAllCall(MessageParcel &data, MessageParcel &reply);
+    int32_t OnHangUpAllCallOnSlot(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetCallState(MessageParcel &data, MessageParcel &reply);
     int32_t OnHoldCall(MessageParcel &data, MessageParcel &reply);
     int32_t OnUnHoldCall(MessageParcel &data, MessageParcel &reply);
@@ -64,6 +64,7 @@ private:
     int32_t OnIsInEmergencyCall(MessageParcel &data, MessageParcel &reply);
     int32_t OnStartDtmf(MessageParcel &data, MessageParcel &reply);
     int32_t OnStopDtmf(MessageParcel &data, MessageParcel &reply);
+    int32_t OnSendDtmfString(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetCallWaiting(MessageParcel &data, MessageParcel &reply);
     int32_t OnSetCallWaiting(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetCallRestriction(MessageParcel &data, MessageParcel &reply);
@@ -86,6 +87,7 @@ private:
     int32_t OnGetMainCallId(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetSubCallIdList(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetCallIdListForConference(MessageParcel &data, MessageParcel &reply);
+    int32_t OnGetCallSnapshot(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetImsConfig(MessageParcel &data, MessageParcel &reply);
     int32_t OnSetImsConfig(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetImsFeatureValue(MessageParcel &data, MessageParcel &reply);
@@ -102,7 +104,11 @@ private:
     int32_t OnReportOttCallDetailsInfo(MessageParcel &data, MessageParcel &reply);
     int32_t OnReportOttCallEventInfo(MessageParcel &data, MessageParcel &reply);
     int32_t OnGetProxyObjectPtr(MessageParcel &data, MessageParcel &reply);
-    std::map<uint32_t, CallManagerServiceFunc> memberFuncMap_;
+    int32_t WriteCallSnapshotEntries(const std::vector<CallSnapshotInfo> &callList, MessageParcel &reply);
+    static bool IsResultReply(uint32_t code);
+    static int32_t GetReplyResult(uint32_t code, MessageParcel &reply, int32_t handlerResult);
+    static const CallDispatchTable<CallManagerServiceFunc, CALL_MANAGER_SURFACE_CODE_NUM> memberFuncTable_;
+    CallIpcStatistics ipcStatistics_;
 };
 } // namespace Telephony
 } // namespace OHOS
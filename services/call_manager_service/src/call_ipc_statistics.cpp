@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "call_ipc_statistics.h"
+
+#include <new>
+
+#include "call_manager_errors.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+std::atomic<uint64_t> g_instanceSequence(0);
+
+// the shard of this thread, tagged with the instance that made it
+struct LocalShard {
+    uint64_t instanceId = 0;
+    void *shard = nullptr;
+};
+thread_local LocalShard g_localShard;
+} // namespace
+
+CallIpcStatistics::Shard::Shard(size_t num) : codeNum(num), histograms(new std::atomic<CodeHistogram *>[num])
+{
+    for (size_t i = 0; i < codeNum; ++i) {
+        histograms[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+CallIpcStatistics::Shard::~Shard()
+{
+    for (size_t i = 0; i < codeNum; ++i) {
+        delete histograms[i].load(std::memory_order_relaxed);
+    }
+}
+
+CallIpcStatistics::CallIpcStatistics()
+    : instanceId_(++g_instanceSequence), isEnabled_(true), unknownCodeNum_(0)
+{}
+
+CallIpcStatistics::~CallIpcStatistics() = default;
+
+void CallIpcStatistics::Init(const std::vector<uint32_t> &codes)
+{
+    // the index map is read without a lock afterwards, so it must be complete before the first request
+    codeIndexMap_.clear();
+    for (uint32_t code : codes) {
+        codeIndexMap_.emplace(code, codeIndexMap_.size());
+    }
+}
+
+void CallIpcStatistics::SetEnabled(bool enabled)
+{
+    isEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool CallIpcStatistics::IsEnabled() const
+{
+    return isEnabled_.load(std::memory_order_relaxed);
+}
+
+void CallIpcStatistics::Record(uint32_t code, int32_t result, int64_t latencyUs)
+{
+    CodeHistogram *histogram = GetLocalHistogram(code);
+    if (histogram == nullptr) {
+        return;
+    }
+    histogram->latency.Record(latencyUs);
+    if (result != TELEPHONY_SUCCESS) {
+        Increase(histogram->errorCount);
+    }
+}
+
+void CallIpcStatistics::RecordDescriptorFailure(uint32_t code)
+{
+    CodeHistogram *histogram = GetLocalHistogram(code);
+    if (histogram == nullptr) {
+        return;
+    }
+    Increase(histogram->descriptorFailCount);
+}
+
+void CallIpcStatistics::Dump(std::string &result)
+{
+    result.append("Ohos call_manager ipc requests(microseconds), statistics ")
+        .append(IsEnabled() ? "on" : "off")
+        .append(", unknown codes:")
+        .append(std::to_string(unknownCodeNum_.load(std::memory_order_relaxed)))
+        .append("\n");
+    for (auto &codeIndex : codeIndexMap_) {
+        MergedHistogram merged;
+        MergeHistogram(codeIndex.second, merged);
+        if (merged.latency.GetCount() == 0 && merged.descriptorFailCount == 0) {
+            continue;
+        }
+        result.append("  code:")
+            .append(std::to_string(codeIndex.first))
+            .append(" error:")
+            .append(std::to_string(merged.errorCount))
+            .append(" descriptor fail:")
+            .append(std::to_string(merged.descriptorFailCount));
+        merged.latency.Dump(result);
+    }
+}
+
+CallIpcStatistics::CodeHistogram *CallIpcStatistics::GetLocalHistogram(uint32_t code)
+{
+    auto iter = codeIndexMap_.find(code);
+    if (iter == codeIndexMap_.end()) {
+        unknownCodeNum_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Shard *shard = GetLocalShard();
+    if (shard == nullptr) {
+        return nullptr;
+    }
+    std::atomic<CodeHistogram *> &slot = shard->histograms[iter->second];
+    CodeHistogram *histogram = slot.load(std::memory_order_relaxed);
+    if (histogram == nullptr) {
+        histogram = new (std::nothrow) CodeHistogram();
+        // release, so a dump that sees the pointer also sees the zeroed counters
+        slot.store(histogram, std::memory_order_release);
+    }
+    return histogram;
+}
+
+CallIpcStatistics::Shard *CallIpcStatistics::GetLocalShard()
+{
+    if (g_localShard.instanceId == instanceId_) {
+        return static_cast<Shard *>(g_localShard.shard);
+    }
+    std::unique_ptr<Shard> shard = std::make_unique<Shard>(codeIndexMap_.size());
+    if (shard == nullptr) {
+        return nullptr;
+    }
+    Shard *localShard = shard.get();
+    {
+        // shards live as long as the statistics, a binder thread that exits leaves its counts behind
+        std::lock_guard<std::mutex> lock(shardMutex_);
+        shards_.emplace_back(std::move(shard));
+    }
+    g_localShard.instanceId = instanceId_;
+    g_localShard.shard = localShard;
+    return localShard;
+}
+
+void CallIpcStatistics::MergeHistogram(size_t codeIndex, MergedHistogram &merged)
+{
+    std::lock_guard<std::mutex> lock(shardMutex_);
+    for (auto &shard : shards_) {
+        CodeHistogram *histogram = shard->histograms[codeIndex].load(std::memory_order_acquire);
+        if (histogram == nullptr) {
+            continue;
+        }
+        merged.latency.Merge(histogram->latency);
+        merged.errorCount += histogram->errorCount.load(std::memory_order_relaxed);
+        merged.descriptorFailCount += histogram->descriptorFailCount.load(std::memory_order_relaxed);
+    }
+}
+
+void CallIpcStatistics::Increase(std::atomic<uint32_t> &counter)
+{
+    // only the owning thread writes, a plain load and store is enough and avoids a locked instruction
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+} // namespace Telephony
+} // namespace OHOS
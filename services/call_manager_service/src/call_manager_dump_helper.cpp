@@ -15,13 +15,59 @@
 
 #include "call_manager_dump_helper.h"
 
+#include <cstdlib>
+
+#include "call_latency_tracer.h"
 #include "call_manager_service.h"
+#include "call_object_manager.h"
+#include "call_perf_statistics.h"
+#include "cs_call.h"
+#include "ims_call.h"
+#include "ott_call.h"
+#include "report_call_info_handler.h"
 
 namespace OHOS {
 namespace Telephony {
+namespace {
+constexpr int32_t DECIMAL_BASE = 10;
+
+template<typename T>
+void ShowCallPoolInfo(const char *name, std::string &result)
+{
+    CallObjectPoolStatistics statistics = T::GetPoolStatistics();
+    result.append("  ")
+        .append(name)
+        .append(" object size:")
+        .append(std::to_string(sizeof(T)))
+        .append(" in use:")
+        .append(std::to_string(statistics.inUseCount))
+        .append(" in use bytes:")
+        .append(std::to_string(statistics.inUseCount * sizeof(T)))
+        .append(" pool bytes:")
+        .append(std::to_string(CALL_OBJECT_POOL_SIZE * sizeof(T)))
+        .append(" heap fallback:")
+        .append(std::to_string(statistics.heapAllocCount))
+        .append("\n");
+}
+} // namespace
+
 bool CallManagerDumpHelper::Dump(const std::vector<std::string> &args, std::string &result) const
 {
     result.clear();
+    if (!args.empty() && args[0] == "-perf_dump") {
+        ShowPerfInfo(result);
+        return true;
+    }
+    if (args.size() > 1 && args[0] == "-ipc_statistics") {
+        bool enabled = (args[1] == "on");
+        DelayedSingleton<CallManagerService>::GetInstance()->SetIpcStatisticsEnabled(enabled);
+        result.append("ipc statistics ").append(enabled ? "on" : "off").append("\n");
+        return true;
+    }
+    if (args.size() > 1 && args[0] == "-call_report_coalesce") {
+        SetCallReportCoalesceWindow(args[1], result);
+        return true;
+    }
     ShowHelp(result);
     ShowCallManagerInfo(result);
     return true;
@@ -47,7 +93,11 @@ void CallManagerDumpHelper::ShowHelp(std::string &result) const
         .append("-set_log_level <level>     ")
         .append("set call_manager SA's log level\n")
         .append("-perf_dump         ")
-        .append("dump performance statistics\n");
+        .append("dump performance statistics\n")
+        .append("-ipc_statistics <on|off>    ")
+        .append("turn the per request code ipc statistics on or off\n")
+        .append("-call_report_coalesce <ms>    ")
+        .append("set the window intermediate call state reports are coalesced in, 0 turns it off\n");
 }
 
 void CallManagerDumpHelper::ShowCallManagerInfo(std::string &result) const
@@ -61,5 +111,40 @@ void CallManagerDumpHelper::ShowCallManagerInfo(std::string &result) const
     result.append(DelayedSingleton<CallManagerService>::GetInstance()->GetStartServiceSpent());
     result.append("\n");
 }
+
+void CallManagerDumpHelper::SetCallReportCoalesceWindow(const std::string &arg, std::string &result) const
+{
+    char *end = nullptr;
+    long long windowMs = strtoll(arg.c_str(), &end, DECIMAL_BASE);
+    if (arg.empty() || end == nullptr || *end != '\0' ||
+        !DelayedSingleton<ReportCallInfoHandlerService>::GetInstance()->SetCallReportCoalesceWindow(windowMs)) {
+        result.append("invalid call report coalesce window, expected 0 to ")
+            .append(std::to_string(CALL_REPORT_COALESCE_WINDOW_MAX_MS))
+            .append(" milliseconds\n");
+        return;
+    }
+    result.append("call report coalesce window ").append(std::to_string(windowMs)).append(" milliseconds\n");
+}
+
+void CallManagerDumpHelper::ShowPerfInfo(std::string &result) const
+{
+    DelayedSingleton<CallManagerService>::GetInstance()->DumpIpcStatistics(result);
+    CallPerfStatistics::Dump(result);
+    CallLatencyTracer::Dump(result);
+    result.append("Ohos call_manager call report coalesce window(milliseconds):  ");
+    result.append(
+        std::to_string(DelayedSingleton<ReportCallInfoHandlerService>::GetInstance()->GetCallReportCoalesceWindow()));
+    result.append("\n");
+    result.append("Ohos call_manager coalesced call reports:  ");
+    result.append(
+        std::to_string(DelayedSingleton<ReportCallInfoHandlerService>::GetInstance()->GetSuppressedCallReportNum()));
+    result.append("\n");
+    result.append("Ohos call_manager call objects:  ");
+    result.append(std::to_string(CallObjectManager::GetCallObjectNum()));
+    result.append("\n");
+    ShowCallPoolInfo<CSCall>("cs_call", result);
+    ShowCallPoolInfo<IMSCall>("ims_call", result);
+    ShowCallPoolInfo<OTTCall>("ott_call", result);
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "report_call_info_handler.h"
 #include "cellular_call_connection.h"
 #include "call_records_manager.h"
+#include "call_state_journal.h"
 #include "common_type.h"
 
 namespace OHOS {
@@ -48,6 +49,9 @@ CallManagerService::~CallManagerService()
 
 bool CallManagerService::Init()
 {
+    if (DelayedSingleton<CallStateJournal>::GetInstance()->Init() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGW("CallStateJournal init failed, calls can not be recovered after a restart");
+    }
     if (!DelayedSingleton<CallControlManager>::GetInstance()->Init()) {
         TELEPHONY_LOGE("CallControlManager init failed!");
         return false;
@@ -81,6 +85,8 @@ void CallManagerService::OnStart()
         TELEPHONY_LOGE("Leave, init failed!");
         return;
     }
+    // rebuild the calls of a previous instance of the service before any request is accepted
+    DelayedSingleton<CallStateJournal>::GetInstance()->Recover();
 
     bool ret = SystemAbility::Publish(DelayedSingleton<CallManagerService>::GetInstance().get());
     if (!ret) {
@@ -123,6 +129,8 @@ void CallManagerService::OnStop()
             timeNow->tm_year + startTime_, timeNow->tm_mon + extraMonth_, timeNow->tm_mday, timeNow->tm_hour,
             timeNow->tm_min, timeNow->tm_sec);
     }
+    // a regular stop leaves no calls to recover
+    DelayedSingleton<CallStateJournal>::GetInstance()->Clear();
     state_ = ServiceRunningState::STATE_STOPPED;
 }
 
@@ -246,6 +254,46 @@ int32_t CallManagerService::HangUpCall(int32_t callId)
     }
 }
 
+int32_t CallManagerService::AnswerAndHoldActiveCall(int32_t callId, int32_t videoState)
+{
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->AnswerAndHoldActiveCall(callId, videoState);
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
+int32_t CallManagerService::AnswerAndEndActiveCall(int32_t callId, int32_t videoState)
+{
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->AnswerAndEndActiveCall(callId, videoState);
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
+int32_t CallManagerService::HangUpAllCall()
+{
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->HangUpAllCall();
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
+int32_t CallManagerService::HangUpAllCallOnSlot(int32_t slotId)
+{
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->HangUpAllCallOnSlot(slotId);
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
 int32_t CallManagerService::GetCallState()
 {
     if (callControlManagerPtr_ != nullptr) {
@@ -354,6 +402,17 @@ int32_t CallManagerService::StopDtmf(int32_t callId)
     }
 }
 
+int32_t CallManagerService::SendDtmfString(
+    int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength)
+{
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->SendDtmfString(callId, Str16ToStr8(dtmfString), onLength, offLength);
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
 int32_t CallManagerService::GetCallWaiting(int32_t slotId)
 {
     if (callControlManagerPtr_ != nullptr) {
@@ -625,6 +684,21 @@ std::vector<std::u16string> CallManagerService::GetCallIdListForConference(int32
     return vec;
 }
 
+int32_t CallManagerService::GetCallSnapshot(std::vector<CallSnapshotInfo> &callList)
+{
+    // the snapshot carries the numbers of all calls, so it is only given to callers that may control them
+    if (!TelephonyPermission::CheckPermission(OHOS_PERMISSION_SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Permission denied!");
+        return TELEPHONY_ERR_PERMISSION_ERR;
+    }
+    if (callControlManagerPtr_ != nullptr) {
+        return callControlManagerPtr_->GetCallSnapshot(callList);
+    } else {
+        TELEPHONY_LOGE("callControlManagerPtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+}
+
 int32_t CallManagerService::GetImsConfig(int32_t slotId, ImsConfigItem item)
 {
     if (callControlManagerPtr_ != nullptr) {
@@ -24,120 +24,89 @@
 #include "message_parcel.h"
 
 #include "call_control_manager.h"
+#include "call_latency_tracer.h"
 
 namespace OHOS {
 namespace Telephony {
-CallManagerServiceStub::CallManagerServiceStub()
-{
-    InitCallBasicRequest();
-    InitCallUtilsRequest();
-    InitCallConferenceRequest();
-    InitCallDtmfRequest();
-    InitCallSupplementRequest();
-    initCallConferenceExRequest();
-    InitCallMultimediaRequest();
-    InitImsServiceRequest();
-    InitOttServiceRequest();
-    memberFuncMap_[INTERFACE_GET_PROXY_OBJECT_PTR] = &CallManagerServiceStub::OnGetProxyObjectPtr;
-}
-
-CallManagerServiceStub::~CallManagerServiceStub()
-{
-    memberFuncMap_.clear();
-}
-
-void CallManagerServiceStub::InitCallBasicRequest()
-{
-    memberFuncMap_[INTERFACE_REGISTER_CALLBACK] = &CallManagerServiceStub::OnRegisterCallBack;
-    memberFuncMap_[INTERFACE_UNREGISTER_CALLBACK] = &CallManagerServiceStub::OnUnRegisterCallBack;
-    memberFuncMap_[INTERFACE_DIAL_CALL] = &CallManagerServiceStub::OnDialCall;
-    memberFuncMap_[INTERFACE_ANSWER_CALL] = &CallManagerServiceStub::OnAcceptCall;
-    memberFuncMap_[INTERFACE_REJECT_CALL] = &CallManagerServiceStub::OnRejectCall;
-    memberFuncMap_[INTERFACE_HOLD_CALL] = &CallManagerServiceStub::OnHoldCall;
-    memberFuncMap_[INTERFACE_UNHOLD_CALL] = &CallManagerServiceStub::OnUnHoldCall;
-    memberFuncMap_[INTERFACE_DISCONNECT_CALL] = &CallManagerServiceStub::OnHangUpCall;
-    memberFuncMap_[INTERFACE_GET_CALL_STATE] = &CallManagerServiceStub::OnGetCallState;
-    memberFuncMap_[INTERFACE_SWAP_CALL] = &CallManagerServiceStub::OnSwitchCall;
-}
-
-void CallManagerServiceStub::InitCallUtilsRequest()
-{
-    memberFuncMap_[INTERFACE_HAS_CALL] = &CallManagerServiceStub::OnHasCall;
-    memberFuncMap_[INTERFACE_IS_NEW_CALL_ALLOWED] = &CallManagerServiceStub::OnIsNewCallAllowed;
-    memberFuncMap_[INTERFACE_IS_RINGING] = &CallManagerServiceStub::OnIsRinging;
-    memberFuncMap_[INTERFACE_IS_EMERGENCY_CALL] = &CallManagerServiceStub::OnIsInEmergencyCall;
-    memberFuncMap_[INTERFACE_IS_EMERGENCY_NUMBER] = &CallManagerServiceStub::OnIsEmergencyPhoneNumber;
-    memberFuncMap_[INTERFACE_IS_FORMAT_NUMBER] = &CallManagerServiceStub::OnFormatPhoneNumber;
-    memberFuncMap_[INTERFACE_IS_FORMAT_NUMBER_E164] = &CallManagerServiceStub::OnFormatPhoneNumberToE164;
-}
-
-void CallManagerServiceStub::InitCallConferenceRequest()
-{
-    memberFuncMap_[INTERFACE_COMBINE_CONFERENCE] = &CallManagerServiceStub::OnCombineConference;
-    memberFuncMap_[INTERFACE_SEPARATE_CONFERENCE] = &CallManagerServiceStub::OnSeparateConference;
-    memberFuncMap_[INTERFACE_JOIN_CONFERENCE] = &CallManagerServiceStub::OnJoinConference;
-}
+constexpr CallDispatchTable<CallManagerServiceStub::CallManagerServiceFunc, CALL_MANAGER_SURFACE_CODE_NUM>
+    CallManagerServiceStub::memberFuncTable_({
+        { INTERFACE_REGISTER_CALLBACK, &CallManagerServiceStub::OnRegisterCallBack },
+        { INTERFACE_UNREGISTER_CALLBACK, &CallManagerServiceStub::OnUnRegisterCallBack },
+        { INTERFACE_DIAL_CALL, &CallManagerServiceStub::OnDialCall },
+        { INTERFACE_ANSWER_CALL, &CallManagerServiceStub::OnAcceptCall },
+        { INTERFACE_REJECT_CALL, &CallManagerServiceStub::OnRejectCall },
+        { INTERFACE_HOLD_CALL, &CallManagerServiceStub::OnHoldCall },
+        { INTERFACE_UNHOLD_CALL, &CallManagerServiceStub::OnUnHoldCall },
+        { INTERFACE_DISCONNECT_CALL, &CallManagerServiceStub::OnHangUpCall },
+        { INTERFACE_GET_CALL_STATE, &CallManagerServiceStub::OnGetCallState },
+        { INTERFACE_SWAP_CALL, &CallManagerServiceStub::OnSwitchCall },
+        { INTERFACE_HAS_CALL, &CallManagerServiceStub::OnHasCall },
+        { INTERFACE_IS_NEW_CALL_ALLOWED, &CallManagerServiceStub::OnIsNewCallAllowed },
+        { INTERFACE_IS_RINGING, &CallManagerServiceStub::OnIsRinging },
+        { INTERFACE_IS_EMERGENCY_CALL, &CallManagerServiceStub::OnIsInEmergencyCall },
+        { INTERFACE_IS_EMERGENCY_NUMBER, &CallManagerServiceStub::OnIsEmergencyPhoneNumber },
+        { INTERFACE_IS_FORMAT_NUMBER, &CallManagerServiceStub::OnFormatPhoneNumber },
+        { INTERFACE_IS_FORMAT_NUMBER_E164, &CallManagerServiceStub::OnFormatPhoneNumberToE164 },
+        { INTERFACE_COMBINE_CONFERENCE, &CallManagerServiceStub::OnCombineConference },
+        { INTERFACE_SEPARATE_CONFERENCE, &CallManagerServiceStub::OnSeparateConference },
+        { INTERFACE_JOIN_CONFERENCE, &CallManagerServiceStub::OnJoinConference },
+        { INTERFACE_START_DTMF, &CallManagerServiceStub::OnStartDtmf },
+        { INTERFACE_STOP_DTMF, &CallManagerServiceStub::OnStopDtmf },
+        { INTERFACE_GET_CALL_WAITING, &CallManagerServiceStub::OnGetCallWaiting },
+        { INTERFACE_SET_CALL_WAITING, &CallManagerServiceStub::OnSetCallWaiting },
+        { INTERFACE_GET_CALL_RESTRICTION, &CallManagerServiceStub::OnGetCallRestriction },
+        { INTERFACE_SET_CALL_RESTRICTION, &CallManagerServiceStub::OnSetCallRestriction },
+        { INTERFACE_GET_CALL_TRANSFER, &CallManagerServiceStub::OnGetTransferNumber },
+        { INTERFACE_SET_CALL_TRANSFER, &CallManagerServiceStub::OnSetTransferNumber },
+        { INTERFACE_GET_MAINID, &CallManagerServiceStub::OnGetMainCallId },
+        { INTERFACE_GET_SUBCALL_LIST_ID, &CallManagerServiceStub::OnGetSubCallIdList },
+        { INTERFACE_GET_CALL_LIST_ID_FOR_CONFERENCE, &CallManagerServiceStub::OnGetCallIdListForConference },
+        { INTERFACE_SET_MUTE, &CallManagerServiceStub::OnSetMute },
+        { INTERFACE_MUTE_RINGER, &CallManagerServiceStub::OnMuteRinger },
+        { INTERFACE_SET_AUDIO_DEVICE, &CallManagerServiceStub::OnSetAudioDevice },
+        { INTERFACE_CTRL_CAMERA, &CallManagerServiceStub::OnControlCamera },
+        { INTERFACE_SET_PREVIEW_WINDOW, &CallManagerServiceStub::OnSetPreviewWindow },
+        { INTERFACE_SET_DISPLAY_WINDOW, &CallManagerServiceStub::OnSetDisplayWindow },
+        { INTERFACE_SET_CAMERA_ZOOM, &CallManagerServiceStub::OnSetCameraZoom },
+        { INTERFACE_SET_PAUSE_IMAGE, &CallManagerServiceStub::OnSetPausePicture },
+        { INTERFACE_SET_DEVICE_DIRECTION, &CallManagerServiceStub::OnSetDeviceDirection },
+        { INTERFACE_UPDATE_CALL_MEDIA_MODE, &CallManagerServiceStub::OnUpdateCallMediaMode },
+        { INTERFACE_SETCALL_PREFERENCEMODE, &CallManagerServiceStub::OnSetCallPreferenceMode },
+        { INTERFACE_GET_IMS_CONFIG, &CallManagerServiceStub::OnGetImsConfig },
+        { INTERFACE_SET_IMS_CONFIG, &CallManagerServiceStub::OnSetImsConfig },
+        { INTERFACE_GET_IMS_FEATURE_VALUE, &CallManagerServiceStub::OnGetImsFeatureValue },
+        { INTERFACE_SET_IMS_FEATURE_VALUE, &CallManagerServiceStub::OnSetImsFeatureValue },
+        { INTERFACE_ENABLE_VOLTE, &CallManagerServiceStub::OnEnableVoLte },
+        { INTERFACE_DISABLE_VOLTE, &CallManagerServiceStub::OnDisableVoLte },
+        { INTERFACE_IS_VOLTE_ENABLED, &CallManagerServiceStub::OnIsVoLteEnabled },
+        { INTERFACE_ENABLE_LTE_ENHANCE_MODE, &CallManagerServiceStub::OnEnableLteEnhanceMode },
+        { INTERFACE_DISABLE_LTE_ENHANCE_MODE, &CallManagerServiceStub::OnDisableEnhanceMode },
+        { INTERFACE_IS_LTE_ENHANCE_MODE_ENABLED, &CallManagerServiceStub::OnIsLteEnhanceModeEnabled },
+        { INTERFACE_START_RTT, &CallManagerServiceStub::OnStartRtt },
+        { INTERFACE_STOP_RTT, &CallManagerServiceStub::OnStopRtt },
+        { INTERFACE_REPORT_OTT_CALL_DETAIL_INFO, &CallManagerServiceStub::OnReportOttCallDetailsInfo },
+        { INTERFACE_REPORT_OTT_CALL_EVENT_INFO, &CallManagerServiceStub::OnReportOttCallEventInfo },
+        { INTERFACE_GET_PROXY_OBJECT_PTR, &CallManagerServiceStub::OnGetProxyObjectPtr },
+        { INTERFACE_ANSWER_AND_HOLD_ACTIVE_CALL, &CallManagerServiceStub::OnAnswerAndHoldActiveCall },
+        { INTERFACE_ANSWER_AND_END_ACTIVE_CALL, &CallManagerServiceStub::OnAnswerAndEndActiveCall },
+        { INTERFACE_HANG_UP_ALL_CALL, &CallManagerServiceStub::OnHangUpAllCall },
+        { INTERFACE_HANG_UP_ALL_CALL_ON_SLOT, &CallManagerServiceStub::OnHangUpAllCallOnSlot },
+        { INTERFACE_GET_CALL_SNAPSHOT, &CallManagerServiceStub::OnGetCallSnapshot },
+        { INTERFACE_SEND_DTMF_STRING, &CallManagerServiceStub::OnSendDtmfString },
+    });
 
-void CallManagerServiceStub::InitCallDtmfRequest()
-{
-    memberFuncMap_[INTERFACE_START_DTMF] = &CallManagerServiceStub::OnStartDtmf;
-    memberFuncMap_[INTERFACE_STOP_DTMF] = &CallManagerServiceStub::OnStopDtmf;
-}
-
-void CallManagerServiceStub::InitCallSupplementRequest()
-{
-    memberFuncMap_[INTERFACE_GET_CALL_WAITING] = &CallManagerServiceStub::OnGetCallWaiting;
-    memberFuncMap_[INTERFACE_SET_CALL_WAITING] = &CallManagerServiceStub::OnSetCallWaiting;
-    memberFuncMap_[INTERFACE_GET_CALL_RESTRICTION] = &CallManagerServiceStub::OnGetCallRestriction;
-    memberFuncMap_[INTERFACE_SET_CALL_RESTRICTION] = &CallManagerServiceStub::OnSetCallRestriction;
-    memberFuncMap_[INTERFACE_GET_CALL_TRANSFER] = &CallManagerServiceStub::OnGetTransferNumber;
-    memberFuncMap_[INTERFACE_SET_CALL_TRANSFER] = &CallManagerServiceStub::OnSetTransferNumber;
-}
-
-void CallManagerServiceStub::initCallConferenceExRequest()
-{
-    memberFuncMap_[INTERFACE_GET_MAINID] = &CallManagerServiceStub::OnGetMainCallId;
-    memberFuncMap_[INTERFACE_GET_SUBCALL_LIST_ID] = &CallManagerServiceStub::OnGetSubCallIdList;
-    memberFuncMap_[INTERFACE_GET_CALL_LIST_ID_FOR_CONFERENCE] =
-        &CallManagerServiceStub::OnGetCallIdListForConference;
-}
-
-void CallManagerServiceStub::InitCallMultimediaRequest()
-{
-    memberFuncMap_[INTERFACE_SET_MUTE] = &CallManagerServiceStub::OnSetMute;
-    memberFuncMap_[INTERFACE_MUTE_RINGER] = &CallManagerServiceStub::OnMuteRinger;
-    memberFuncMap_[INTERFACE_SET_AUDIO_DEVICE] = &CallManagerServiceStub::OnSetAudioDevice;
-    memberFuncMap_[INTERFACE_CTRL_CAMERA] = &CallManagerServiceStub::OnControlCamera;
-    memberFuncMap_[INTERFACE_SET_PREVIEW_WINDOW] = &CallManagerServiceStub::OnSetPreviewWindow;
-    memberFuncMap_[INTERFACE_SET_DISPLAY_WINDOW] = &CallManagerServiceStub::OnSetDisplayWindow;
-    memberFuncMap_[INTERFACE_SET_CAMERA_ZOOM] = &CallManagerServiceStub::OnSetCameraZoom;
-    memberFuncMap_[INTERFACE_SET_PAUSE_IMAGE] = &CallManagerServiceStub::OnSetPausePicture;
-    memberFuncMap_[INTERFACE_SET_DEVICE_DIRECTION] = &CallManagerServiceStub::OnSetDeviceDirection;
-    memberFuncMap_[INTERFACE_UPDATE_CALL_MEDIA_MODE] = &CallManagerServiceStub::OnUpdateCallMediaMode;
-}
-
-void CallManagerServiceStub::InitImsServiceRequest()
+CallManagerServiceStub::CallManagerServiceStub()
 {
-    memberFuncMap_[INTERFACE_SETCALL_PREFERENCEMODE] = &CallManagerServiceStub::OnSetCallPreferenceMode;
-    memberFuncMap_[INTERFACE_GET_IMS_CONFIG] = &CallManagerServiceStub::OnGetImsConfig;
-    memberFuncMap_[INTERFACE_SET_IMS_CONFIG] = &CallManagerServiceStub::OnSetImsConfig;
-    memberFuncMap_[INTERFACE_GET_IMS_FEATURE_VALUE] = &CallManagerServiceStub::OnGetImsFeatureValue;
-    memberFuncMap_[INTERFACE_SET_IMS_FEATURE_VALUE] = &CallManagerServiceStub::OnSetImsFeatureValue;
-    memberFuncMap_[INTERFACE_ENABLE_VOLTE] = &CallManagerServiceStub::OnEnableVoLte;
-    memberFuncMap_[INTERFACE_DISABLE_VOLTE] = &CallManagerServiceStub::OnDisableVoLte;
-    memberFuncMap_[INTERFACE_IS_VOLTE_ENABLED] = &CallManagerServiceStub::OnIsVoLteEnabled;
-    memberFuncMap_[INTERFACE_ENABLE_LTE_ENHANCE_MODE] = &CallManagerServiceStub::OnEnableLteEnhanceMode;
-    memberFuncMap_[INTERFACE_DISABLE_LTE_ENHANCE_MODE] = &CallManagerServiceStub::OnDisableEnhanceMode;
-    memberFuncMap_[INTERFACE_IS_LTE_ENHANCE_MODE_ENABLED] = &CallManagerServiceStub::OnIsLteEnhanceModeEnabled;
-    memberFuncMap_[INTERFACE_START_RTT] = &CallManagerServiceStub::OnStartRtt;
-    memberFuncMap_[INTERFACE_STOP_RTT] = &CallManagerServiceStub::OnStopRtt;
+    std::vector<uint32_t> codes;
+    for (uint32_t code = 0; code < memberFuncTable_.GetCodeNum(); ++code) {
+        if (memberFuncTable_.Find(code) != nullptr) {
+            codes.emplace_back(code);
+        }
+    }
+    ipcStatistics_.Init(codes);
 }
 
-void CallManagerServiceStub::InitOttServiceRequest()
-{
-    memberFuncMap_[INTERFACE_REPORT_OTT_CALL_DETAIL_INFO] = &CallManagerServiceStub::OnReportOttCallDetailsInfo;
-    memberFuncMap_[INTERFACE_REPORT_OTT_CALL_EVENT_INFO] = &CallManagerServiceStub::OnReportOttCallEventInfo;
-}
+CallManagerServiceStub::~CallManagerServiceStub() {}
 
 int32_t CallManagerServiceStub::OnRemoteRequest(
     uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
@@ -146,19 +115,74 @@ int32_t CallManagerServiceStub::OnRemoteRequest(
     std::u16string remoteDescriptor = data.ReadInterfaceToken();
     if (myDescriptor != remoteDescriptor) {
         TELEPHONY_LOGE("descriptor checked fail !");
+        ipcStatistics_.RecordDescriptorFailure(code);
         return TELEPHONY_ERR_DESCRIPTOR_MISMATCH;
     }
-    TELEPHONY_LOGI("OnReceived, cmd = %{public}u", code);
-    auto itFunc = memberFuncMap_.find(code);
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
+    TELEPHONY_LOGD("OnReceived, cmd = %{public}u", code);
+    auto memberFunc = memberFuncTable_.Find(code);
+    if (memberFunc != nullptr) {
+        if (!ipcStatistics_.IsEnabled()) {
             return (this->*memberFunc)(data, reply);
         }
+        int64_t beginTime = CallLatencyTracer::GetTraceTime();
+        int32_t result = (this->*memberFunc)(data, reply);
+        ipcStatistics_.Record(
+            code, GetReplyResult(code, reply, result), CallLatencyTracer::GetElapsedTime(beginTime));
+        return result;
     }
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
 
+// whether the reply starts with the result code of the request, the listed ones start with a value instead
+bool CallManagerServiceStub::IsResultReply(uint32_t code)
+{
+    switch (code) {
+        case INTERFACE_GET_CALL_STATE:
+        case INTERFACE_HAS_CALL:
+        case INTERFACE_IS_NEW_CALL_ALLOWED:
+        case INTERFACE_IS_RINGING:
+        case INTERFACE_IS_EMERGENCY_CALL:
+        case INTERFACE_IS_EMERGENCY_NUMBER:
+        case INTERFACE_IS_FORMAT_NUMBER:
+        case INTERFACE_IS_FORMAT_NUMBER_E164:
+        case INTERFACE_GET_MAINID:
+        case INTERFACE_GET_SUBCALL_LIST_ID:
+        case INTERFACE_GET_CALL_LIST_ID_FOR_CONFERENCE:
+        case INTERFACE_GET_PROXY_OBJECT_PTR:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/**
+ * a handler returns TELEPHONY_SUCCESS whenever it wrote the reply, so whether the request failed is
+ * the result code it wrote first. Replies without a result code only fail when they are not written.
+ */
+int32_t CallManagerServiceStub::GetReplyResult(uint32_t code, MessageParcel &reply, int32_t handlerResult)
+{
+    if (handlerResult != TELEPHONY_SUCCESS || !IsResultReply(code)) {
+        return handlerResult;
+    }
+    size_t readPosition = reply.GetReadPosition();
+    int32_t result = TELEPHONY_ERR_READ_DATA_FAIL;
+    if (!reply.ReadInt32(result)) {
+        result = TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    reply.RewindRead(readPosition);
+    return result;
+}
+
+void CallManagerServiceStub::DumpIpcStatistics(std::string &result)
+{
+    ipcStatistics_.Dump(result);
+}
+
+void CallManagerServiceStub::SetIpcStatisticsEnabled(bool enabled)
+{
+    ipcStatistics_.SetEnabled(enabled);
+}
+
 int32_t CallManagerServiceStub::OnRegisterCallBack(MessageParcel &data, MessageParcel &reply)
 {
     int32_t result = TELEPHONY_ERR_FAIL;
@@ -187,6 +211,7 @@ int32_t CallManagerServiceStub::OnUnRegisterCallBack(MessageParcel &data, Messag
 
 int32_t CallManagerServiceStub::OnDialCall(MessageParcel &data, MessageParcel &reply)
 {
+    CallLatencyTraceScope traceScope(CallLatencyTracer::GetTraceTime());
     int32_t result = TELEPHONY_ERR_FAIL;
     AppExecFwk::PacMap dialInfo;
     std::u16string callNumber = data.ReadString16();
@@ -248,6 +273,55 @@ int32_t CallManagerServiceStub::OnHangUpCall(MessageParcel &data, MessageParcel
     return result;
 }
 
+int32_t CallManagerServiceStub::OnAnswerAndHoldActiveCall(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t callId = data.ReadInt32();
+    int32_t videoState = data.ReadInt32();
+    int32_t result = AnswerAndHoldActiveCall(callId, videoState);
+    TELEPHONY_LOGI("result:%{public}d", result);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return result;
+}
+
+int32_t CallManagerServiceStub::OnAnswerAndEndActiveCall(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t callId = data.ReadInt32();
+    int32_t videoState = data.ReadInt32();
+    int32_t result = AnswerAndEndActiveCall(callId, videoState);
+    TELEPHONY_LOGI("result:%{public}d", result);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return result;
+}
+
+int32_t CallManagerServiceStub::OnHangUpAllCall(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t result = HangUpAllCall();
+    TELEPHONY_LOGI("result:%{public}d", result);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return result;
+}
+
+int32_t CallManagerServiceStub::OnHangUpAllCallOnSlot(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    int32_t result = HangUpAllCallOnSlot(slotId);
+    TELEPHONY_LOGI("result:%{public}d", result);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return result;
+}
+
 int32_t CallManagerServiceStub::OnGetCallState(MessageParcel &data, MessageParcel &reply)
 {
     int32_t result = GetCallState();
@@ -401,6 +475,22 @@ int32_t CallManagerServiceStub::OnStopDtmf(MessageParcel &data, MessageParcel &r
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallManagerServiceStub::OnSendDtmfString(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t result = TELEPHONY_ERR_FAIL;
+    int32_t callId = data.ReadInt32();
+    std::u16string dtmfString = data.ReadString16();
+    int32_t onLength = data.ReadInt32();
+    int32_t offLength = data.ReadInt32();
+    result = SendDtmfString(callId, dtmfString, onLength, offLength);
+    TELEPHONY_LOGI("result:%{public}d", result);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallManagerServiceStub::OnGetCallWaiting(MessageParcel &data, MessageParcel &reply)
 {
     int32_t result = TELEPHONY_ERR_FAIL;
@@ -702,6 +792,57 @@ int32_t CallManagerServiceStub::OnGetCallIdListForConference(MessageParcel &data
     return TELEPHONY_SUCCESS;
 }
 
+int32_t CallManagerServiceStub::OnGetCallSnapshot(MessageParcel &data, MessageParcel &reply)
+{
+    std::vector<CallSnapshotInfo> callList;
+    int32_t result = GetCallSnapshot(callList);
+    if (!reply.WriteInt32(result)) {
+        TELEPHONY_LOGE("GetCallSnapshot fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    if (result != TELEPHONY_SUCCESS) {
+        return TELEPHONY_SUCCESS;
+    }
+    if (!reply.WriteUint32(CALL_SNAPSHOT_VERSION) || !reply.WriteUint32(sizeof(CallSnapshotInfo)) ||
+        !reply.WriteUint32(callList.size())) {
+        TELEPHONY_LOGE("GetCallSnapshot fail to write parcel");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return WriteCallSnapshotEntries(callList, reply);
+}
+
+int32_t CallManagerServiceStub::WriteCallSnapshotEntries(
+    const std::vector<CallSnapshotInfo> &callList, MessageParcel &reply)
+{
+    int32_t length = static_cast<int32_t>(sizeof(CallSnapshotInfo) * callList.size());
+    if (length <= CALL_SNAPSHOT_ASHMEM_THRESHOLD) {
+        if (!reply.WriteInt32(CALL_SNAPSHOT_TRANSPORT_PARCEL) || !reply.WriteInt32(length)) {
+            TELEPHONY_LOGE("GetCallSnapshot fail to write parcel");
+            return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+        }
+        if (length > 0 && !reply.WriteRawData((const void *)callList.data(), length)) {
+            TELEPHONY_LOGE("GetCallSnapshot fail to write raw data");
+            return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+        }
+        return TELEPHONY_SUCCESS;
+    }
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem("CallSnapshot", length);
+    if (ashmem == nullptr) {
+        TELEPHONY_LOGE("create ashmem failed, length:%{public}d", length);
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    bool isWritten = ashmem->MapReadAndWriteAshmem() && ashmem->WriteToAshmem(callList.data(), length, 0) &&
+        reply.WriteInt32(CALL_SNAPSHOT_TRANSPORT_ASHMEM) && reply.WriteAshmem(ashmem);
+    // the parcel holds its own descriptor of the region, the local mapping is not needed any more
+    ashmem->UnmapAshmem();
+    ashmem->CloseAshmem();
+    if (!isWritten) {
+        TELEPHONY_LOGE("GetCallSnapshot fail to write ashmem");
+        return TELEPHONY_ERR_WRITE_REPLY_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallManagerServiceStub::OnGetImsConfig(MessageParcel &data, MessageParcel &reply)
 {
     int32_t result = TELEPHONY_ERR_FAIL;
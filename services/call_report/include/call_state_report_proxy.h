@@ -27,7 +27,8 @@ class CallStateReportProxy : public CallStateListenerBase {
 public:
     CallStateReportProxy();
     ~CallStateReportProxy();
-    void CallStateUpdated(sptr<CallBase> &callObjectPtr, TelCallState priorState, TelCallState nextState);
+    void CallSnapshotUpdated(sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info, TelCallState priorState,
+        TelCallState nextState) override;
     int32_t ReportCallState(int32_t slotId, int32_t callState, std::u16string phoneNumber);
     int32_t ReportCallStateForCallId(
         int32_t slotId, int32_t callId, int32_t callState, std::u16string incomingNumber);
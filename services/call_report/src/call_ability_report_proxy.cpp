@@ -24,6 +24,8 @@
 #include "call_manager_errors.h"
 #include "telephony_log_wrapper.h"
 
+#include "call_latency_tracer.h"
+
 namespace OHOS {
 namespace Telephony {
 CallAbilityReportProxy::CallAbilityReportProxy()
@@ -93,9 +95,8 @@ void CallAbilityReportProxy::CallStateUpdated(
         TELEPHONY_LOGE("callObjectPtr is nullptr!");
         return;
     }
-    CallAttributeInfo info;
-    callObjectPtr->GetCallAttributeInfo(info);
-    ReportCallStateInfo(info);
+    std::shared_ptr<const CallAttributeInfo> info = callObjectPtr->GetCallAttributeSnapshot();
+    ReportCallStateInfo(*info);
 }
 
 void CallAbilityReportProxy::CallEventUpdated(CallEventInfo &info)
@@ -123,6 +124,7 @@ void CallAbilityReportProxy::CallDestroyed(int32_t cause)
 
 int32_t CallAbilityReportProxy::ReportCallStateInfo(const CallAttributeInfo &info)
 {
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_REPORT_OBSERVER);
     int32_t ret = TELEPHONY_ERR_FAIL;
     std::string bundleName = "";
     std::lock_guard<std::mutex> lock(mutex_);
@@ -140,6 +142,7 @@ int32_t CallAbilityReportProxy::ReportCallStateInfo(const CallAttributeInfo &inf
             }
         }
     }
+    CallLatencyTracer::EndTrace(CALL_LATENCY_STAGE_REPORT_IPC, CALL_LATENCY_STAGE_REPORT_TOTAL);
     TELEPHONY_LOGI("report call state[%{public}d] conferenceState[%{public}d] info success", info.callState,
         info.conferenceState);
     return ret;
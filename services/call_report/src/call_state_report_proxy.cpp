@@ -32,21 +32,15 @@ CallStateReportProxy::CallStateReportProxy() {}
 
 CallStateReportProxy::~CallStateReportProxy() {}
 
-void CallStateReportProxy::CallStateUpdated(
-    sptr<CallBase> &callObjectPtr, TelCallState priorState, TelCallState nextState)
+void CallStateReportProxy::CallSnapshotUpdated(
+    sptr<CallBase> &callObjectPtr, const CallAttributeInfo &info, TelCallState priorState, TelCallState nextState)
 {
-    if (callObjectPtr == nullptr) {
-        TELEPHONY_LOGE("callObjectPtr is nullptr!");
-        return;
-    }
-    CallAttributeInfo info;
-    callObjectPtr->GetCallAttributeInfo(info);
     std::string str(info.accountNumber);
     std::u16string accountNumber = Str8ToStr16(str);
-    if (info.callState == TelCallState::CALL_STATUS_INCOMING) {
-        ReportCallState(info.accountId, static_cast<int32_t>(info.callState), accountNumber);
+    if (nextState == TelCallState::CALL_STATUS_INCOMING) {
+        ReportCallState(info.accountId, static_cast<int32_t>(nextState), accountNumber);
     } else {
-        ReportCallStateForCallId(info.accountId, info.callId, static_cast<int32_t>(info.callState), accountNumber);
+        ReportCallStateForCallId(info.accountId, info.callId, static_cast<int32_t>(nextState), accountNumber);
     }
 }
 
@@ -58,6 +58,10 @@ public:
     int32_t SetLteEnhanceModeResult(const int32_t result) override;
     int32_t ReceiveUpdateCallMediaModeResponse(const CallMediaModeResponse &response) override;
     int32_t InviteToConferenceResult(const int32_t result) override;
+
+private:
+    // results of requests CellularCallConnection may have sent one-way, they complete the tracked request
+    int32_t ReportRequestResult(CallResultReportId reportId, AppExecFwk::PacMap &resultInfo);
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -16,15 +16,20 @@
 #ifndef CELLULAR_CALL_CONNECTION_H
 #define CELLULAR_CALL_CONNECTION_H
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 #include "if_system_ability_manager.h"
 #include "refbase.h"
 #include "rwlock.h"
 #include "singleton.h"
+#include "telephony_types.h"
 
 #include "call_status_callback.h"
+#include "cellular_call_dtmf_sender.h"
 #include "cellular_call_interface.h"
+#include "cellular_call_request_tracker.h"
 #include "i_call_status_callback.h"
 #include "timer.h"
 
@@ -148,6 +153,25 @@ public:
      */
     int StopDtmf(const CellularCallInfo &callInfo);
 
+    /**
+     * StartStreamedDtmf
+     *
+     * @brief Enable and send a DTMF digit of a DTMF string, its result is not reported to the app
+     * @param cDTMFCode[in], Characters sent
+     * @param callInfo[in], Call information.
+     * @return Returns 0 on success, others on failure.
+     */
+    int StartStreamedDtmf(char cDTMFCode, const CellularCallInfo &callInfo);
+
+    /**
+     * StopStreamedDtmf
+     *
+     * @brief Stop a DTMF digit of a DTMF string, its result is not reported to the app
+     * @param callInfo[in], Call information.
+     * @return Returns 0 on success, others on failure.
+     */
+    int StopStreamedDtmf(const CellularCallInfo &callInfo);
+
     /**
      * SendDtmf
      *
@@ -161,16 +185,23 @@ public:
     /**
      * SendDtmfString
      *
-     * @brief Send a string of DTMFS
-     * @param dtmfCodeStr[in], Characters sent
-     * @param phoneNum[in], Phone number corresponding to the call
-     * @param phoneNetType[in].
-     * @param switchOn[in].
-     * @param switchOff[in].
+     * @brief Send a string of DTMFS, the digits are streamed as StartDtmf and StopDtmf in the background
+     * @param dtmfCodeStr[in], Characters sent, pause and wait characters included
+     * @param callInfo[in], Call information.
+     * @param onLength[in], tone duration of a digit in ms
+     * @param offLength[in], gap between two digits in ms
      * @return Returns TELEPHONY_SUCCESS on success, others on failure.
      */
-    int SendDtmfString(const std::string &dtmfCodeStr, const std::string &phoneNum, PhoneNetType phoneNetType,
-        int32_t switchOn, int32_t switchOff);
+    int SendDtmfString(
+        const std::string &dtmfCodeStr, const CellularCallInfo &callInfo, int32_t onLength, int32_t offLength);
+
+    /**
+     * ClearDtmfString
+     *
+     * @brief Drop the DTMF digits left of a call that is gone, before its call id is given to another call
+     * @param callId[in], The id of the call
+     */
+    void ClearDtmfString(int32_t callId);
 
     /**
      * SetCallTransferInfo
@@ -437,6 +468,25 @@ public:
      */
     int32_t SetMute(int32_t mute, int32_t slotId);
 
+    /**
+     * OnAsyncResultReceived
+     *
+     * @brief Called by CallStatusCallback for every result reported by the cellular call service,
+     * completes the oldest outstanding tracked request waiting for this report id
+     * @param reportId[in], The report id of the result
+     * @return Returns false when the result is stale or its request is not reported, true otherwise.
+     */
+    bool OnAsyncResultReceived(CallResultReportId reportId);
+
+    /**
+     * SetCellularCallInterface
+     *
+     * @brief Use a cellular call service of this process instead of the system ability, e.g. a stub
+     * service in benchmarks. Requests to it are always synchronous.
+     * @param cellularCall[in], The cellular call service
+     */
+    void SetCellularCallInterface(const sptr<CellularCallInterface> &cellularCall);
+
 private:
     int32_t ConnectService();
     int32_t RegisterCallBackFun();
@@ -445,6 +495,28 @@ private:
     void OnDeath();
     void Clean();
     void NotifyDeath();
+    // the requests take their own reference, so a reconnect or a death never waits for a request in flight
+    sptr<CellularCallInterface> GetCellularCallInterface();
+    /**
+     * the modem handles the call control requests of one slot in order, so they are sent one at a time per slot.
+     * Requests of different slots and the supplementary service and IMS setting requests run concurrently.
+     */
+    std::mutex &GetSlotMutex(int32_t slotId);
+    /**
+     * with one-way requests enabled the request is tracked until its result is reported with reportId.
+     * The proxy sends it one-way only if the service can not reject it up front, otherwise the error the
+     * service returns drops it from tracking and is returned at once.
+     */
+    template<typename Request>
+    int32_t SendResultReportedRequest(CallResultReportId reportId, Request request);
+    /**
+     * a request whose result is not reported to the app is always tracked, so that its result is
+     * told apart from the results of the reported requests of the same report id.
+     */
+    template<typename Request>
+    int32_t SendTrackedRequest(CallResultReportId reportId, bool isReported, Request request);
+    int SendStartDtmf(char cDTMFCode, const CellularCallInfo &callInfo, bool isReported);
+    int SendStopDtmf(const CellularCallInfo &callInfo, bool isReported);
 
 private:
     int32_t systemAbilityId_;
@@ -453,7 +525,12 @@ private:
     sptr<IRemoteObject::DeathRecipient> cellularCallRecipient_;
     bool connectState_;
     Utils::RWLock rwClientLock_;
-    std::mutex mutex_;
+    std::mutex slotMutex_[SIM_SLOT_COUNT];
+    std::atomic<bool> asyncRequestEnabled_;
+    std::shared_ptr<CellularCallRequestTracker> requestTracker_;
+    // a request is tracked and sent under the mutex of its report id, so both happen in the same order
+    std::mutex requestOrderMutex_[CALL_RESULT_REPORT_ID_NUM];
+    std::shared_ptr<CellularCallDtmfSender> dtmfSender_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CELLULAR_CALL_DTMF_SENDER_H
+#define CELLULAR_CALL_DTMF_SENDER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "event_handler.h"
+#include "event_runner.h"
+
+#include "call_manager_inner_type.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @ClassName:CellularCallDtmfSender
+ * @Description:plays a DTMF string of a call digit by digit, each digit is a StartDtmf held for the
+ * on length and a StopDtmf followed by the off length. A pause character holds the string for
+ * DTMF_PAUSE_LENGTH, a wait character holds it until the app sends an empty string to continue.
+ * The local tone of a digit is played for the same on length. The results of the single digits are
+ * not reported, the app gets one SEND_DTMF_STRING_REPORT_ID result when the string is done.
+ */
+class CellularCallDtmfSender : public AppExecFwk::EventHandler {
+public:
+    explicit CellularCallDtmfSender(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
+    ~CellularCallDtmfSender() = default;
+
+    // appends the string to the digits left of the call, an empty string resumes a string held by a wait character
+    int32_t AddString(const std::string &dtmfString, const CellularCallInfo &callInfo, int32_t onLength,
+        int32_t offLength);
+    // the call is gone, its digits left are dropped. Its id may be given to the next call right after.
+    void RemoveString(int32_t callId);
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+
+    enum {
+        DTMF_TONE_START_EVENT = 0,
+        DTMF_TONE_STOP_EVENT,
+    };
+
+private:
+    struct DtmfString {
+        // the events of a string carry its serial, an event of a dropped string finds no string
+        uint64_t serial;
+        CellularCallInfo callInfo;
+        std::string digits;
+        size_t nextIndex;
+        int32_t onLength;
+        int32_t offLength;
+        bool isWaiting;
+        int32_t result;
+    };
+
+    static bool IsDtmfDigit(char c);
+    static bool IsPauseChar(char c);
+    static bool IsWaitChar(char c);
+    static bool IsCallAlive(int32_t callId);
+    static bool IsSameCall(const CellularCallInfo &callInfo, const CellularCallInfo &otherCallInfo);
+    static void ReportStringDone(int32_t callId, int32_t result);
+    std::map<int32_t, DtmfString>::iterator FindString(uint64_t serial);
+    void StartTone(uint64_t serial);
+    void StopTone(uint64_t serial);
+
+    std::mutex mutex_;
+    uint64_t nextSerial_ = 1;
+    std::map<int32_t, DtmfString> dtmfStrings_;
+    // only touched on the sender thread, the serial of the string whose local tone is playing
+    uint64_t toneSerial_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CELLULAR_CALL_DTMF_SENDER_H
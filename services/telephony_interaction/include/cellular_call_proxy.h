@@ -16,6 +16,8 @@
 #ifndef CELLULAR_CALL_PROXY_H
 #define CELLULAR_CALL_PROXY_H
 
+#include <atomic>
+
 #include "cellular_call_interface.h"
 #include "iremote_proxy.h"
 
@@ -438,8 +440,30 @@ public:
      */
     int32_t GetMute(int32_t slotId) override;
 
+    /**
+     * SetOneWayRequestEnabled
+     *
+     * @brief Send the supplementary service setters, whose result is reported by ICallStatusCallback,
+     * as one-way transactions, they return as soon as the request is queued to the cellular call service.
+     * @param enabled[in], Whether one-way requests are enabled
+     */
+    void SetOneWayRequestEnabled(bool enabled);
+
 private:
+    static bool IsOneWayRequest(OperationType type);
+    /**
+     * writes the interface token, MAX_SIZE and args into the request parcel of the calling thread,
+     * every argument shape is written by one WriteRequestArg overload.
+     */
+    template<typename... Args>
+    int32_t TransactCellularRequest(OperationType type, MessageParcel &out, const Args &...args);
+    // sends the request and returns the result written by the stub, or the transaction error.
+    // A one-way request has no reply and returns TELEPHONY_SUCCESS once it is queued.
+    template<typename... Args>
+    int32_t SendCellularRequest(OperationType type, const Args &...args);
+
     const int32_t MAX_SIZE = 10;
+    std::atomic<bool> isOneWayRequestEnabled_ = false;
     static inline BrokerDelegator<CellularCallProxy> delegator_;
 };
 } // namespace Telephony
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CELLULAR_CALL_REQUEST_TRACKER_H
+#define CELLULAR_CALL_REQUEST_TRACKER_H
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "event_handler.h"
+#include "event_runner.h"
+
+#include "call_manager_inner_type.h"
+
+namespace OHOS {
+namespace Telephony {
+// a request without a result after this long is reported to the app as failed
+constexpr int64_t CELLULAR_CALL_ASYNC_REQUEST_TIMEOUT_MS = 5000;
+// supplementary services wait for the network, well above the time the modem gives them on its own
+constexpr int64_t CELLULAR_CALL_SS_REQUEST_TIMEOUT_MS = 60000;
+// the report ids of the results the cellular call service reports through ICallStatusCallback
+constexpr size_t CALL_RESULT_REPORT_ID_NUM = static_cast<size_t>(CallResultReportId::UPDATE_MEDIA_MODE_REPORT_ID) + 1;
+
+/**
+ * @ClassName:CellularCallRequestTracker
+ * @Description:keeps the one-way requests sent to the cellular call service until their result arrives
+ * through ICallStatusCallback. One-way transactions to a service are delivered in order and the service
+ * reports the results of one kind in the same order, so a result is matched to the oldest outstanding
+ * request of its report id. A request still outstanding after the timeout of its report id is reported
+ * as failed, and its result, if it comes within another timeout, is dropped. A timed out request may
+ * never get a result, e.g. the modem stayed silent, so the drop expires and later results match again.
+ */
+class CellularCallRequestTracker : public AppExecFwk::EventHandler {
+public:
+    explicit CellularCallRequestTracker(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
+    ~CellularCallRequestTracker() = default;
+
+    // the result of a request that is not reported is consumed here, e.g. a digit of a DTMF string
+    uint64_t AddRequest(CallResultReportId reportId, bool isReported);
+    // drops a request whose transaction failed, nothing is reported for it
+    void RemoveRequest(CallResultReportId reportId, uint64_t requestId);
+    // returns false when the result is not to be reported: its request is not reported or has timed out already
+    bool OnResultReceived(CallResultReportId reportId);
+    bool HasRequest(CallResultReportId reportId);
+    // the service is gone, its outstanding requests are reported as failed and nothing more is expected
+    void Reset();
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+
+private:
+    struct PendingRequest {
+        uint64_t requestId;
+        std::chrono::steady_clock::time_point sendTime;
+        bool isReported;
+    };
+
+    static int64_t GetRequestTimeout(size_t index);
+    void DropExpiredLateResults(size_t index);
+    bool EraseRequest(size_t index, uint64_t requestId, bool &isReported);
+    static void ReportRequestFailed(size_t index, int32_t result);
+
+    std::mutex mutex_;
+    uint64_t nextRequestId_ = 1;
+    std::deque<PendingRequest> pendingRequests_[CALL_RESULT_REPORT_ID_NUM];
+    // until when the result of a timed out request is dropped instead of matching a later request
+    std::deque<std::chrono::steady_clock::time_point> lateResultDeadlines_[CALL_RESULT_REPORT_ID_NUM];
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CELLULAR_CALL_REQUEST_TRACKER_H
@@ -16,6 +16,7 @@
 #ifndef REPORT_CALL_INFO_HANDLER_H
 #define REPORT_CALL_INFO_HANDLER_H
 
+#include <map>
 #include <memory>
 #include <mutex>
 
@@ -23,29 +24,28 @@
 #include "event_runner.h"
 #include "singleton.h"
 
+#include "call_dispatch_table.h"
+#include "call_perf_statistics.h"
 #include "call_status_manager.h"
 
 namespace OHOS {
 namespace Telephony {
-class ReportCallInfoHandler : public AppExecFwk::EventHandler {
-public:
-    ReportCallInfoHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
-    virtual ~ReportCallInfoHandler();
-    void Init();
-    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+// a held report delays the ui by up to the window, so it is kept well below what a user notices
+constexpr int64_t CALL_REPORT_COALESCE_WINDOW_MAX_MS = 200;
+// long enough to fold the reports of one hold or switch, changed with the dump option -call_report_coalesce
+constexpr int64_t CALL_REPORT_COALESCE_WINDOW_DEFAULT_MS = 50;
 
-private:
-    using CallManagerServiceFunc = void (ReportCallInfoHandler::*)(const AppExecFwk::InnerEvent::Pointer &event);
-    void ReportCallInfo(const AppExecFwk::InnerEvent::Pointer &event);
-    void ReportCallsInfo(const AppExecFwk::InnerEvent::Pointer &event);
-    void ReportDisconnectedCause(const AppExecFwk::InnerEvent::Pointer &event);
-    void ReportEventInfo(const AppExecFwk::InnerEvent::Pointer &event);
-    void ReportOttEvent(const AppExecFwk::InnerEvent::Pointer &event);
-    void OnUpdateMediaModeResponse(const AppExecFwk::InnerEvent::Pointer &event);
-    std::map<uint32_t, CallManagerServiceFunc> memberFuncMap_;
-    std::unique_ptr<CallStatusManager> callStatusManagerPtr_;
-};
+class ReportCallInfoHandler;
 
+/**
+ * @ClassName:ReportCallInfoHandlerService
+ * @Description:queues the reports of the cellular call service to the handler thread. With a coalesce
+ * window set, the first report of a call that only moves it between intermediate states is sent at once
+ * and opens the window, the ones that follow within it are held and a newer one replaces the held one,
+ * so a burst during hold or switch is handled at most twice. Reports of one slot keep their order, the
+ * held reports of the other calls and the call list of the slot are sent before a report is held.
+ * Incoming, dialing and terminal states are never held, and they send the held reports first.
+ */
 class ReportCallInfoHandlerService : public std::enable_shared_from_this<ReportCallInfoHandlerService> {
     DECLARE_DELAYED_SINGLETON(ReportCallInfoHandlerService)
 public:
@@ -56,6 +56,10 @@ public:
     int32_t UpdateEventResultInfo(const CellularCallEventInfo &info);
     int32_t UpdateOttEventInfo(const OttCallEventInfo &info);
     int32_t UpdateMediaModeResponse(const CallMediaModeResponse &response);
+    bool SetCallReportCoalesceWindow(int64_t windowMs);
+    int64_t GetCallReportCoalesceWindow();
+    int64_t GetSuppressedCallReportNum();
+    void FlushPendingCallReport(int64_t reportKey);
 
     enum {
         HANDLER_UPDATE_CELLULAR_CALL_INFO = 0,
@@ -64,12 +68,63 @@ public:
         HANDLER_UPDATE_CELLULAR_EVENT_RESULT_INFO,
         HANDLER_UPDATE_OTT_EVENT_RESULT_INFO,
         HANDLE_UPDATE_MEDIA_MODE_RESPONSE,
+        HANDLER_FLUSH_PENDING_CALL_REPORT,
+        HANDLER_EVENT_NUM,
     };
 
 private:
+    template<typename... Args>
+    bool SendHandlerEvent(Args &&...args)
+    {
+        return CallPerfStatistics::SendEvent(CALL_EVENT_QUEUE_REPORT, *handler_, std::forward<Args>(args)...);
+    }
+
+    // a key is present while its window is open, a report is only held when isHeld is set
+    struct PendingCallReport {
+        bool isHeld = false;
+        bool isCallList = false;
+        CallDetailInfo info;
+        CallDetailsInfo infoList;
+        int64_t traceBeginTime = 0;
+    };
+    int32_t SendCallReportInfo(const CallDetailInfo &info, int64_t traceBeginTime);
+    int32_t SendCallsReportInfo(const CallDetailsInfo &info, int64_t traceBeginTime);
+    bool IsCoalescableState(TelCallState state);
+    bool IsCoalescableCallList(const CallDetailsInfo &info, int64_t reportKey);
+    bool HoldPendingCallReport(int64_t reportKey, PendingCallReport &report);
+    void SendPendingCallReportLocked(const PendingCallReport &report);
+    void FlushSlotPendingCallReportLocked(int64_t reportKey);
+    void FlushAllPendingCallReportLocked();
+    int64_t GetCallReportKey(int32_t slotId, int32_t index);
+
+    std::mutex pendingMutex_;
+    std::map<int64_t, PendingCallReport> pendingReportMap_;
+    int64_t coalesceWindowMs_;
+    int64_t suppressedReportNum_;
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<ReportCallInfoHandler> handler_;
 };
+
+class ReportCallInfoHandler : public AppExecFwk::EventHandler {
+public:
+    ReportCallInfoHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner);
+    virtual ~ReportCallInfoHandler();
+    void Init();
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event);
+
+private:
+    using CallManagerServiceFunc = void (ReportCallInfoHandler::*)(const AppExecFwk::InnerEvent::Pointer &event);
+    void ReportCallInfo(const AppExecFwk::InnerEvent::Pointer &event);
+    void ReportCallsInfo(const AppExecFwk::InnerEvent::Pointer &event);
+    void ReportDisconnectedCause(const AppExecFwk::InnerEvent::Pointer &event);
+    void ReportEventInfo(const AppExecFwk::InnerEvent::Pointer &event);
+    void ReportOttEvent(const AppExecFwk::InnerEvent::Pointer &event);
+    void OnUpdateMediaModeResponse(const AppExecFwk::InnerEvent::Pointer &event);
+    void FlushPendingCallReport(const AppExecFwk::InnerEvent::Pointer &event);
+    static const CallDispatchTable<CallManagerServiceFunc, ReportCallInfoHandlerService::HANDLER_EVENT_NUM>
+        memberFuncTable_;
+    std::unique_ptr<CallStatusManager> callStatusManagerPtr_;
+};
 } // namespace Telephony
 } // namespace OHOS
 
@@ -19,6 +19,8 @@
 #include "telephony_log_wrapper.h"
 
 #include "call_ability_report_proxy.h"
+#include "call_latency_tracer.h"
+#include "cellular_call_connection.h"
 #include "report_call_info_handler.h"
 #include "audio_control_manager.h"
 
@@ -30,6 +32,7 @@ CallStatusCallback::~CallStatusCallback() {}
 
 int32_t CallStatusCallback::UpdateCallReportInfo(const CallReportInfo &info)
 {
+    CallLatencyTraceScope traceScope(CallLatencyTracer::GetTraceTime());
     CallDetailInfo detailInfo;
     detailInfo.callType = info.callType;
     detailInfo.accountId = info.accountId;
@@ -50,6 +53,7 @@ int32_t CallStatusCallback::UpdateCallReportInfo(const CallReportInfo &info)
 
 int32_t CallStatusCallback::UpdateCallsReportInfo(const CallsReportInfo &info)
 {
+    CallLatencyTraceScope traceScope(CallLatencyTracer::GetTraceTime());
     CallDetailsInfo detailsInfo;
     CallDetailInfo detailInfo;
     CallsReportInfo callsInfo = info;
@@ -115,7 +119,7 @@ int32_t CallStatusCallback::StartDtmfResult(const int32_t result)
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
     TELEPHONY_LOGI("StartDtmfResult result = %{public}d", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::StopDtmfResult(const int32_t result)
@@ -124,7 +128,7 @@ int32_t CallStatusCallback::StopDtmfResult(const int32_t result)
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
     TELEPHONY_LOGI("StopDtmfResult result = %{public}d", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::SendUssdResult(const int32_t result)
@@ -164,7 +168,7 @@ int32_t CallStatusCallback::UpdateSetWaitingResult(const int32_t result)
     CallResultReportId reportId = CallResultReportId::SET_CALL_WAITING_REPORT_ID;
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
-    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    ReportRequestResult(reportId, resultInfo);
     return TELEPHONY_SUCCESS;
 }
 
@@ -186,7 +190,7 @@ int32_t CallStatusCallback::UpdateSetRestrictionResult(const int32_t result)
     CallResultReportId reportId = CallResultReportId::SET_CALL_RESTRICTION_REPORT_ID;
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::UpdateGetTransferResult(const CallTransferResponse &response)
@@ -207,7 +211,7 @@ int32_t CallStatusCallback::UpdateSetTransferResult(const int32_t result)
     CallResultReportId reportId = CallResultReportId::SET_CALL_TRANSFER_REPORT_ID;
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::UpdateGetCallClipResult(const ClipResponse &clipResponse)
@@ -260,7 +264,7 @@ int32_t CallStatusCallback::SetVoLteStatusResult(const LteImsSwitchResponse &swi
     CallResultReportId reportId = CallResultReportId::SET_CALL_VOTLE_REPORT_ID;
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", switchResponse.result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::StartRttResult(const int32_t result)
@@ -297,7 +301,7 @@ int32_t CallStatusCallback::SetImsConfigResult(const int32_t result)
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
     TELEPHONY_LOGI("result = %{public}d", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::GetImsFeatureValueResult(const GetImsFeatureValueResponse &response)
@@ -316,7 +320,7 @@ int32_t CallStatusCallback::SetImsFeatureValueResult(const int32_t result)
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
     TELEPHONY_LOGI("result = %{public}d", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::GetLteEnhanceModeResult(const GetLteEnhanceModeResponse &response)
@@ -335,7 +339,7 @@ int32_t CallStatusCallback::SetLteEnhanceModeResult(const int32_t result)
     AppExecFwk::PacMap resultInfo;
     resultInfo.PutIntValue("result", result);
     TELEPHONY_LOGI("SetLteEnhanceModeResult result = %{public}d", result);
-    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+    return ReportRequestResult(reportId, resultInfo);
 }
 
 int32_t CallStatusCallback::ReceiveUpdateCallMediaModeResponse(const CallMediaModeResponse &response)
@@ -356,5 +360,13 @@ int32_t CallStatusCallback::InviteToConferenceResult(const int32_t result)
     TELEPHONY_LOGI("InviteToConferenceResult result = %{public}d", result);
     return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
 }
+
+int32_t CallStatusCallback::ReportRequestResult(CallResultReportId reportId, AppExecFwk::PacMap &resultInfo)
+{
+    if (!DelayedSingleton<CellularCallConnection>::GetInstance()->OnAsyncResultReceived(reportId)) {
+        return TELEPHONY_SUCCESS;
+    }
+    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(reportId, resultInfo);
+}
 } // namespace Telephony
 } // namespace OHOS
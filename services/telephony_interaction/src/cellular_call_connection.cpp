@@ -23,8 +23,11 @@
 
 #include "call_manager_errors.h"
 #include "cellular_call_death_recipient.h"
+#include "cellular_call_proxy.h"
 #include "telephony_log_wrapper.h"
 
+#include "call_latency_tracer.h"
+
 namespace OHOS {
 namespace Telephony {
 #ifdef RECONNECT_MAX_TRY_COUNT
@@ -32,7 +35,8 @@ constexpr uint16_t CONNECT_MAX_TRY_COUNT = 5;
 #endif
 CellularCallConnection::CellularCallConnection()
     : systemAbilityId_(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID), cellularCallCallbackPtr_(nullptr),
-    cellularCallInterfacePtr_(nullptr), connectState_(false)
+    cellularCallInterfacePtr_(nullptr), connectState_(false), asyncRequestEnabled_(false),
+    requestTracker_(nullptr), dtmfSender_(nullptr)
 {}
 
 CellularCallConnection::~CellularCallConnection()
@@ -43,6 +47,20 @@ CellularCallConnection::~CellularCallConnection()
 void CellularCallConnection::Init(int32_t systemAbilityId)
 {
     systemAbilityId_ = systemAbilityId;
+    if (requestTracker_ == nullptr) {
+        std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create("CellularCallRequestTracker");
+        if (runner != nullptr) {
+            requestTracker_ = std::make_shared<CellularCallRequestTracker>(runner);
+            runner->Run();
+        }
+    }
+    if (dtmfSender_ == nullptr) {
+        std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create("CellularCallDtmfSender");
+        if (runner != nullptr) {
+            dtmfSender_ = std::make_shared<CellularCallDtmfSender>(runner);
+            runner->Run();
+        }
+    }
     int32_t result = ConnectService();
     if (result != TELEPHONY_SUCCESS) {
 #ifdef CELLULAR_SUPPORT
@@ -83,7 +101,19 @@ int32_t CellularCallConnection::ConnectService()
     if (iRemoteObjectPtr == nullptr) {
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    cellularCallInterfacePtr = iface_cast<CellularCallInterface>(iRemoteObjectPtr);
+    bool asyncRequestEnabled = false;
+    if (iRemoteObjectPtr->IsProxyObject() && requestTracker_ != nullptr) {
+        // results of the tracked requests come back through the callback, they need no reply
+        sptr<CellularCallProxy> cellularCallProxy = new (std::nothrow) CellularCallProxy(iRemoteObjectPtr);
+        if (cellularCallProxy != nullptr) {
+            cellularCallProxy->SetOneWayRequestEnabled(true);
+            cellularCallInterfacePtr = cellularCallProxy.GetRefPtr();
+            asyncRequestEnabled = true;
+        }
+    }
+    if (cellularCallInterfacePtr == nullptr) {
+        cellularCallInterfacePtr = iface_cast<CellularCallInterface>(iRemoteObjectPtr);
+    }
     if (!cellularCallInterfacePtr) {
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
@@ -106,6 +136,7 @@ int32_t CellularCallConnection::ConnectService()
     if (ret != TELEPHONY_SUCCESS) {
         return ret;
     }
+    asyncRequestEnabled_ = asyncRequestEnabled;
     connectState_ = true;
     return TELEPHONY_SUCCESS;
 }
@@ -153,6 +184,9 @@ int32_t CellularCallConnection::ReConnectService()
 void CellularCallConnection::OnDeath()
 {
     Clean();
+    if (requestTracker_ != nullptr) {
+        requestTracker_->Reset();
+    }
     NotifyDeath();
 }
 
@@ -171,9 +205,18 @@ void CellularCallConnection::Clean()
         cellularCallCallbackPtr_.clear();
         cellularCallCallbackPtr_ = nullptr;
     }
+    asyncRequestEnabled_ = false;
     connectState_ = false;
 }
 
+void CellularCallConnection::SetCellularCallInterface(const sptr<CellularCallInterface> &cellularCall)
+{
+    Utils::UniqueWriteGuard<Utils::RWLock> guard(rwClientLock_);
+    cellularCallInterfacePtr_ = cellularCall;
+    asyncRequestEnabled_ = false;
+    connectState_ = (cellularCall != nullptr);
+}
+
 void CellularCallConnection::NotifyDeath()
 {
     TELEPHONY_LOGI("service is dead, connect again");
@@ -191,15 +234,77 @@ void CellularCallConnection::NotifyDeath()
     Timer::start(CONNECT_SERVICE_WAIT_TIME, CellularCallConnection::task);
 }
 
-int CellularCallConnection::Dial(const CellularCallInfo &callInfo)
+sptr<CellularCallInterface> CellularCallConnection::GetCellularCallInterface()
 {
+    {
+        Utils::UniqueReadGuard<Utils::RWLock> guard(rwClientLock_);
+        if (cellularCallInterfacePtr_ != nullptr) {
+            return cellularCallInterfacePtr_;
+        }
+    }
     if (ReConnectService() != TELEPHONY_SUCCESS) {
+        return nullptr;
+    }
+    Utils::UniqueReadGuard<Utils::RWLock> guard(rwClientLock_);
+    return cellularCallInterfacePtr_;
+}
+
+std::mutex &CellularCallConnection::GetSlotMutex(int32_t slotId)
+{
+    // an invalid slot is rejected by the cellular call service, it is ordered with slot 0
+    if (slotId < 0 || slotId >= SIM_SLOT_COUNT) {
+        return slotMutex_[0];
+    }
+    return slotMutex_[slotId];
+}
+
+template<typename Request>
+int32_t CellularCallConnection::SendResultReportedRequest(CallResultReportId reportId, Request request)
+{
+    return SendTrackedRequest(reportId, true, request);
+}
+
+template<typename Request>
+int32_t CellularCallConnection::SendTrackedRequest(CallResultReportId reportId, bool isReported, Request request)
+{
+    size_t index = static_cast<size_t>(reportId);
+    if ((!asyncRequestEnabled_ && isReported) || requestTracker_ == nullptr || index >= CALL_RESULT_REPORT_ID_NUM) {
+        return request();
+    }
+    std::lock_guard<std::mutex> lock(requestOrderMutex_[index]);
+    uint64_t requestId = requestTracker_->AddRequest(reportId, isReported);
+    int32_t errCode = request();
+    if (errCode != TELEPHONY_SUCCESS) {
+        requestTracker_->RemoveRequest(reportId, requestId);
+    }
+    return errCode;
+}
+
+bool CellularCallConnection::OnAsyncResultReceived(CallResultReportId reportId)
+{
+    if (requestTracker_ == nullptr) {
+        return true;
+    }
+    // without one-way requests only the requests that are not reported are tracked
+    if (!asyncRequestEnabled_ && !requestTracker_->HasRequest(reportId)) {
+        return true;
+    }
+    // its request is not reported, or has timed out and the timeout has been reported in its place
+    return requestTracker_->OnResultReceived(reportId);
+}
+
+int CellularCallConnection::Dial(const CellularCallInfo &callInfo)
+{
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
     TELEPHONY_LOGI("callType:%{public}d", callInfo.callType);
-    int errCode = cellularCallInterfacePtr_->Dial(callInfo);
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_DIAL_HANDLE);
+    int errCode = cellularCall->Dial(callInfo);
+    CallLatencyTracer::EndTrace(CALL_LATENCY_STAGE_DIAL_IPC, CALL_LATENCY_STAGE_DIAL_TOTAL);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("dial failed, errcode:%{public}d", errCode);
         return errCode;
@@ -209,12 +314,13 @@ int CellularCallConnection::Dial(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::HangUp(const CellularCallInfo &callInfo, CallSupplementType type)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->HangUp(callInfo, type);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->HangUp(callInfo, type);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("hangup call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -224,12 +330,13 @@ int CellularCallConnection::HangUp(const CellularCallInfo &callInfo, CallSupplem
 
 int CellularCallConnection::Reject(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->Reject(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->Reject(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("rejecting call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -239,12 +346,13 @@ int CellularCallConnection::Reject(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::Answer(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->Answer(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->Answer(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("answering call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -254,12 +362,13 @@ int CellularCallConnection::Answer(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::HoldCall(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->HoldCall(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->HoldCall(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("holding call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -269,12 +378,13 @@ int CellularCallConnection::HoldCall(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::UnHoldCall(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->UnHoldCall(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->UnHoldCall(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("unhold call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -284,12 +394,13 @@ int CellularCallConnection::UnHoldCall(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::SwitchCall(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SwitchCall(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->SwitchCall(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("switch call failed, errcode:%{public}d", errCode);
         return errCode;
@@ -299,22 +410,23 @@ int CellularCallConnection::SwitchCall(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::IsEmergencyPhoneNumber(const std::string &phoneNum, int32_t slotId, int32_t &errorCode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return cellularCallInterfacePtr_->IsEmergencyPhoneNumber(slotId, phoneNum, errorCode);
+    return cellularCall->IsEmergencyPhoneNumber(slotId, phoneNum, errorCode);
 }
 
 int CellularCallConnection::CombineConference(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->CombineConference(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->CombineConference(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("combine conference failed, errcode:%{public}d", errCode);
         return errCode;
@@ -324,12 +436,13 @@ int CellularCallConnection::CombineConference(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::SeparateConference(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SeparateConference(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->SeparateConference(callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("separate conference failed, errcode:%{public}d", errCode);
         return errCode;
@@ -339,12 +452,34 @@ int CellularCallConnection::SeparateConference(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::StartDtmf(char cDTMFCode, const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    return SendStartDtmf(cDTMFCode, callInfo, true);
+}
+
+int CellularCallConnection::StopDtmf(const CellularCallInfo &callInfo)
+{
+    return SendStopDtmf(callInfo, true);
+}
+
+int CellularCallConnection::StartStreamedDtmf(char cDTMFCode, const CellularCallInfo &callInfo)
+{
+    return SendStartDtmf(cDTMFCode, callInfo, false);
+}
+
+int CellularCallConnection::StopStreamedDtmf(const CellularCallInfo &callInfo)
+{
+    return SendStopDtmf(callInfo, false);
+}
+
+int CellularCallConnection::SendStartDtmf(char cDTMFCode, const CellularCallInfo &callInfo, bool isReported)
+{
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->StartDtmf(cDTMFCode, callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = SendTrackedRequest(CallResultReportId::START_DTMF_REPORT_ID, isReported,
+        [&]() { return cellularCall->StartDtmf(cDTMFCode, callInfo); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("start dtmf failed, errcode:%{public}d", errCode);
         return errCode;
@@ -352,14 +487,16 @@ int CellularCallConnection::StartDtmf(char cDTMFCode, const CellularCallInfo &ca
     return TELEPHONY_SUCCESS;
 }
 
-int CellularCallConnection::StopDtmf(const CellularCallInfo &callInfo)
+int CellularCallConnection::SendStopDtmf(const CellularCallInfo &callInfo, bool isReported)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->StopDtmf(callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = SendTrackedRequest(CallResultReportId::STOP_DTMF_REPORT_ID, isReported,
+        [&]() { return cellularCall->StopDtmf(callInfo); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("stop dtmf failed, errcode:%{public}d", errCode);
         return errCode;
@@ -369,7 +506,8 @@ int CellularCallConnection::StopDtmf(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::SendDtmf(char cDTMFCode, const std::string &phoneNum)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
@@ -382,8 +520,8 @@ int CellularCallConnection::SendDtmf(char cDTMFCode, const std::string &phoneNum
         TELEPHONY_LOGE("send dtmf return, strcpy_s fail.");
         return TELEPHONY_ERR_STRCPY_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SendDtmf(cDTMFCode, callInfo);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->SendDtmf(cDTMFCode, callInfo);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("send dtmf failed, errcode:%{public}d", errCode);
         return errCode;
@@ -391,44 +529,53 @@ int CellularCallConnection::SendDtmf(char cDTMFCode, const std::string &phoneNum
     return TELEPHONY_SUCCESS;
 }
 
-int CellularCallConnection::SendDtmfString(const std::string &dtmfCodeStr, const std::string &phoneNum,
-    PhoneNetType phoneNetType, int32_t switchOn, int32_t switchOff)
+int CellularCallConnection::SendDtmfString(
+    const std::string &dtmfCodeStr, const CellularCallInfo &callInfo, int32_t onLength, int32_t offLength)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
-        TELEPHONY_LOGE("ipc reconnect failed!");
-        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    if (dtmfSender_ == nullptr) {
+        TELEPHONY_LOGE("dtmfSender_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    return dtmfSender_->AddString(dtmfCodeStr, callInfo, onLength, offLength);
+}
+
+void CellularCallConnection::ClearDtmfString(int32_t callId)
+{
+    if (dtmfSender_ != nullptr) {
+        dtmfSender_->RemoveString(callId);
     }
-    return TELEPHONY_SUCCESS;
 }
 
 int CellularCallConnection::SetCallTransferInfo(const CallTransferInfo &info, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return cellularCallInterfacePtr_->SetCallTransferInfo(slotId, info);
+    return SendResultReportedRequest(CallResultReportId::SET_CALL_TRANSFER_REPORT_ID,
+        [&]() { return cellularCall->SetCallTransferInfo(slotId, info); });
 }
 
 int CellularCallConnection::GetCallTransferInfo(CallTransferType type, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return cellularCallInterfacePtr_->GetCallTransferInfo(slotId, type);
+    return cellularCall->GetCallTransferInfo(slotId, type);
 }
 
 int CellularCallConnection::SetCallWaiting(bool activate, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetCallWaiting(slotId, activate);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_CALL_WAITING_REPORT_ID,
+        [&]() { return cellularCall->SetCallWaiting(slotId, activate); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetCallWaiting failed, errcode:%{public}d", errCode);
         return errCode;
@@ -438,12 +585,12 @@ int CellularCallConnection::SetCallWaiting(bool activate, int32_t slotId)
 
 int CellularCallConnection::GetCallWaiting(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->GetCallWaiting(slotId);
+    int errCode = cellularCall->GetCallWaiting(slotId);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetCallWaiting failed, errcode:%{public}d", errCode);
         return errCode;
@@ -453,32 +600,33 @@ int CellularCallConnection::GetCallWaiting(int32_t slotId)
 
 int CellularCallConnection::SetCallRestriction(const CallRestrictionInfo &info, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return cellularCallInterfacePtr_->SetCallRestriction(slotId, info);
+    return SendResultReportedRequest(CallResultReportId::SET_CALL_RESTRICTION_REPORT_ID,
+        [&]() { return cellularCall->SetCallRestriction(slotId, info); });
 }
 
 int CellularCallConnection::GetCallRestriction(CallRestrictionType facType, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return cellularCallInterfacePtr_->GetCallRestriction(slotId, facType);
+    return cellularCall->GetCallRestriction(slotId, facType);
 }
 
 int CellularCallConnection::SetCallPreferenceMode(int32_t slotId, int32_t mode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetDomainPreferenceMode(slotId, mode);
+    int errCode = cellularCall->SetDomainPreferenceMode(slotId, mode);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetCallPreferenceMode failed, errcode:%{public}d", errCode);
         return errCode;
@@ -488,13 +636,14 @@ int CellularCallConnection::SetCallPreferenceMode(int32_t slotId, int32_t mode)
 
 int CellularCallConnection::StartRtt(const CellularCallInfo &callInfo, std::u16string &msg)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
     int32_t slotId = callInfo.slotId;
-    int errCode = cellularCallInterfacePtr_->StartRtt(slotId, Str16ToStr8(msg));
+    int errCode = cellularCall->StartRtt(slotId, Str16ToStr8(msg));
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("StartRtt failed, errcode:%{public}d", errCode);
         return errCode;
@@ -504,13 +653,14 @@ int CellularCallConnection::StartRtt(const CellularCallInfo &callInfo, std::u16s
 
 int CellularCallConnection::StopRtt(const CellularCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
     int32_t slotId = callInfo.slotId;
-    int errCode = cellularCallInterfacePtr_->StopRtt(slotId);
+    int errCode = cellularCall->StopRtt(slotId);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("StopRtt failed, errcode:%{public}d", errCode);
         return errCode;
@@ -520,12 +670,12 @@ int CellularCallConnection::StopRtt(const CellularCallInfo &callInfo)
 
 int CellularCallConnection::RegisterCallBack(const sptr<ICallStatusCallback> &callback)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->RegisterCallManagerCallBack(callback);
+    int errCode = cellularCall->RegisterCallManagerCallBack(callback);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("registerCallBack failed, errcode:%{public}d", errCode);
         return errCode;
@@ -535,12 +685,12 @@ int CellularCallConnection::RegisterCallBack(const sptr<ICallStatusCallback> &ca
 
 int32_t CellularCallConnection::ControlCamera(std::u16string cameraId, int32_t callingUid, int32_t callingPid)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->CtrlCamera(cameraId, callingUid, callingPid);
+    int errCode = cellularCall->CtrlCamera(cameraId, callingUid, callingPid);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("cellularCallInterface CtrlCamera failed, errcode:%{public}d", errCode);
         return errCode;
@@ -549,13 +699,13 @@ int32_t CellularCallConnection::ControlCamera(std::u16string cameraId, int32_t c
 }
 int32_t CellularCallConnection::SetPreviewWindow(VideoWindow &window)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
     int errCode =
-        cellularCallInterfacePtr_->SetPreviewWindow(window.x, window.y, window.z, window.width, window.height);
+        cellularCall->SetPreviewWindow(window.x, window.y, window.z, window.width, window.height);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetPreviewWindow failed, errcode:%{public}d", errCode);
         return errCode;
@@ -565,13 +715,13 @@ int32_t CellularCallConnection::SetPreviewWindow(VideoWindow &window)
 
 int32_t CellularCallConnection::SetDisplayWindow(VideoWindow &window)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
     int errCode =
-        cellularCallInterfacePtr_->SetDisplayWindow(window.x, window.y, window.z, window.width, window.height);
+        cellularCall->SetDisplayWindow(window.x, window.y, window.z, window.width, window.height);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetDisplayWindow failed, errcode:%{public}d", errCode);
         return errCode;
@@ -581,12 +731,12 @@ int32_t CellularCallConnection::SetDisplayWindow(VideoWindow &window)
 
 int32_t CellularCallConnection::SetCameraZoom(float zoomRatio)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetCameraZoom(zoomRatio);
+    int errCode = cellularCall->SetCameraZoom(zoomRatio);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetCameraZoom failed, errcode:%{public}d", errCode);
         return errCode;
@@ -596,12 +746,12 @@ int32_t CellularCallConnection::SetCameraZoom(float zoomRatio)
 
 int32_t CellularCallConnection::SetPausePicture(std::u16string path)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetPauseImage(path);
+    int errCode = cellularCall->SetPauseImage(path);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetPauseImage failed, errcode:%{public}d", errCode);
         return errCode;
@@ -611,12 +761,12 @@ int32_t CellularCallConnection::SetPausePicture(std::u16string path)
 
 int32_t CellularCallConnection::SetDeviceDirection(int32_t rotation)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetDeviceDirection(rotation);
+    int errCode = cellularCall->SetDeviceDirection(rotation);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetDeviceDirection failed, errcode:%{public}d", errCode);
         return errCode;
@@ -626,12 +776,13 @@ int32_t CellularCallConnection::SetDeviceDirection(int32_t rotation)
 
 int32_t CellularCallConnection::SetLteImsSwitchStatus(int32_t slotId, bool active)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetLteImsSwitchStatus(slotId, active);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_CALL_VOTLE_REPORT_ID,
+        [&]() { return cellularCall->SetLteImsSwitchStatus(slotId, active); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetLteImsSwitchStatus failed, errcode:%{public}d", errCode);
         return errCode;
@@ -641,12 +792,12 @@ int32_t CellularCallConnection::SetLteImsSwitchStatus(int32_t slotId, bool activ
 
 int32_t CellularCallConnection::GetLteImsSwitchStatus(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->GetLteImsSwitchStatus(slotId);
+    int errCode = cellularCall->GetLteImsSwitchStatus(slotId);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetLteImsSwitchStatus failed, errcode:%{public}d", errCode);
         return errCode;
@@ -656,12 +807,13 @@ int32_t CellularCallConnection::GetLteImsSwitchStatus(int32_t slotId)
 
 int32_t CellularCallConnection::SendUpdateCallMediaModeRequest(const CellularCallInfo &callInfo, ImsCallMode mode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->UpdateImsCallMode(callInfo, mode);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(callInfo.slotId));
+    int errCode = cellularCall->UpdateImsCallMode(callInfo, mode);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("send media modify request failed, errcode:%{public}d", errCode);
         return errCode;
@@ -671,12 +823,13 @@ int32_t CellularCallConnection::SendUpdateCallMediaModeRequest(const CellularCal
 
 int32_t CellularCallConnection::SetImsConfig(ImsConfigItem item, const std::string &value, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetImsConfig(slotId, item, value);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_IMS_CONFIG_REPORT_ID,
+        [&]() { return cellularCall->SetImsConfig(slotId, item, value); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetImsConfig failed, errcode:%{public}d", errCode);
         return errCode;
@@ -686,12 +839,13 @@ int32_t CellularCallConnection::SetImsConfig(ImsConfigItem item, const std::stri
 
 int32_t CellularCallConnection::SetImsConfig(ImsConfigItem item, int32_t value, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetImsConfig(slotId, item, value);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_IMS_CONFIG_REPORT_ID,
+        [&]() { return cellularCall->SetImsConfig(slotId, item, value); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetLteImsSwitchStatus failed, errcode:%{public}d", errCode);
         return errCode;
@@ -701,12 +855,12 @@ int32_t CellularCallConnection::SetImsConfig(ImsConfigItem item, int32_t value,
 
 int32_t CellularCallConnection::GetImsConfig(ImsConfigItem item, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->GetImsConfig(slotId, item);
+    int errCode = cellularCall->GetImsConfig(slotId, item);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetImsConfig failed, errcode:%{public}d", errCode);
         return errCode;
@@ -716,12 +870,13 @@ int32_t CellularCallConnection::GetImsConfig(ImsConfigItem item, int32_t slotId)
 
 int32_t CellularCallConnection::SetImsFeatureValue(FeatureType type, int32_t value, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetImsFeatureValue(slotId, type, value);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_IMS_FEATURE_VALUE_REPORT_ID,
+        [&]() { return cellularCall->SetImsFeatureValue(slotId, type, value); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetImsFeatureValue failed, errcode:%{public}d", errCode);
         return errCode;
@@ -731,12 +886,12 @@ int32_t CellularCallConnection::SetImsFeatureValue(FeatureType type, int32_t val
 
 int32_t CellularCallConnection::GetImsFeatureValue(FeatureType type, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->GetImsFeatureValue(slotId, type);
+    int errCode = cellularCall->GetImsFeatureValue(slotId, type);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetImsFeatureValue failed, errcode:%{public}d", errCode);
         return errCode;
@@ -746,12 +901,13 @@ int32_t CellularCallConnection::GetImsFeatureValue(FeatureType type, int32_t slo
 
 int32_t CellularCallConnection::SetVolteEnhanceMode(bool value, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetImsSwitchEnhanceMode(slotId, value);
+    int errCode = SendResultReportedRequest(CallResultReportId::SET_LTE_ENHANCE_MODE_REPORT_ID,
+        [&]() { return cellularCall->SetImsSwitchEnhanceMode(slotId, value); });
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetVolteEnhanceMode failed, errcode:%{public}d", errCode);
         return errCode;
@@ -761,12 +917,12 @@ int32_t CellularCallConnection::SetVolteEnhanceMode(bool value, int32_t slotId)
 
 int32_t CellularCallConnection::GetVolteEnhanceMode(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->GetImsSwitchEnhanceMode(slotId);
+    int errCode = cellularCall->GetImsSwitchEnhanceMode(slotId);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("GetVolteEnhanceMode failed, errcode:%{public}d", errCode);
         return errCode;
@@ -776,12 +932,13 @@ int32_t CellularCallConnection::GetVolteEnhanceMode(int32_t slotId)
 
 int32_t CellularCallConnection::InviteToConference(const std::vector<std::string> &numberList, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->InviteToConference(slotId, numberList);
+    std::lock_guard<std::mutex> lock(GetSlotMutex(slotId));
+    int errCode = cellularCall->InviteToConference(slotId, numberList);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("InviteToConference failed, errcode:%{public}d", errCode);
         return errCode;
@@ -791,12 +948,12 @@ int32_t CellularCallConnection::InviteToConference(const std::vector<std::string
 
 int32_t CellularCallConnection::SetMute(int32_t mute, int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<CellularCallInterface> cellularCall = GetCellularCallInterface();
+    if (cellularCall == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    int errCode = cellularCallInterfacePtr_->SetMute(slotId, mute);
+    int errCode = cellularCall->SetMute(slotId, mute);
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SetMute failed, errcode:%{public}d", errCode);
         return errCode;
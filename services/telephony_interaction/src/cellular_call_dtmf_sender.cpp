@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_dtmf_sender.h"
+
+#include "call_manager_errors.h"
+#include "telephony_log_wrapper.h"
+
+#include "audio_control_manager.h"
+#include "call_ability_report_proxy.h"
+#include "call_object_manager.h"
+#include "cellular_call_connection.h"
+
+namespace OHOS {
+namespace Telephony {
+CellularCallDtmfSender::CellularCallDtmfSender(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
+    : AppExecFwk::EventHandler(runner)
+{}
+
+int32_t CellularCallDtmfSender::AddString(
+    const std::string &dtmfString, const CellularCallInfo &callInfo, int32_t onLength, int32_t offLength)
+{
+    for (char c : dtmfString) {
+        if (!IsDtmfDigit(c) && !IsPauseChar(c) && !IsWaitChar(c)) {
+            TELEPHONY_LOGE("invalid dtmf char:%{public}c", c);
+            return TELEPHONY_ERR_ARGUMENT_INVALID;
+        }
+    }
+    int32_t callId = callInfo.callId;
+    uint64_t serial = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = dtmfStrings_.find(callId);
+        if (it != dtmfStrings_.end() && !IsSameCall(it->second.callInfo, callInfo)) {
+            TELEPHONY_LOGW("dtmf string of an earlier call dropped, callId:%{public}d", callId);
+            dtmfStrings_.erase(it);
+            it = dtmfStrings_.end();
+        }
+        if (it == dtmfStrings_.end()) {
+            if (dtmfString.empty()) {
+                TELEPHONY_LOGE("no dtmf string is waiting, callId:%{public}d", callId);
+                return TELEPHONY_ERR_ARGUMENT_INVALID;
+            }
+            serial = nextSerial_++;
+            dtmfStrings_[callId] = {serial, callInfo, dtmfString, 0, onLength, offLength, false, TELEPHONY_SUCCESS};
+        } else {
+            DtmfString &entry = it->second;
+            entry.digits.erase(0, entry.nextIndex);
+            entry.nextIndex = 0;
+            entry.digits += dtmfString;
+            entry.onLength = onLength;
+            entry.offLength = offLength;
+            // digits added behind a wait character stay held until the app continues with an empty string
+            if (!entry.isWaiting || !dtmfString.empty()) {
+                return TELEPHONY_SUCCESS;
+            }
+            entry.isWaiting = false;
+            serial = entry.serial;
+        }
+        if (!SendEvent(DTMF_TONE_START_EVENT, static_cast<int64_t>(serial), 0)) {
+            TELEPHONY_LOGE("send dtmf start event failed, callId:%{public}d", callId);
+            dtmfStrings_.erase(callId);
+            return TELEPHONY_ERR_LOCAL_PTR_NULL;
+        }
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void CellularCallDtmfSender::RemoveString(int32_t callId)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (dtmfStrings_.erase(callId) == 0) {
+            return;
+        }
+    }
+    // a tone still playing is stopped by the stop event of the string
+    ReportStringDone(callId, CALL_ERR_CALL_STATE_MISMATCH_OPERATION);
+}
+
+void CellularCallDtmfSender::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        TELEPHONY_LOGE("event is nullptr");
+        return;
+    }
+    uint64_t serial = static_cast<uint64_t>(event->GetParam());
+    switch (event->GetInnerEventId()) {
+        case DTMF_TONE_START_EVENT:
+            StartTone(serial);
+            break;
+        case DTMF_TONE_STOP_EVENT:
+            StopTone(serial);
+            break;
+        default:
+            break;
+    }
+}
+
+void CellularCallDtmfSender::StartTone(uint64_t serial)
+{
+    int32_t callId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindString(serial);
+        if (it == dtmfStrings_.end()) {
+            return;
+        }
+        callId = it->first;
+    }
+    bool isAlive = IsCallAlive(callId);
+    CellularCallInfo callInfo;
+    char digit = '\0';
+    int32_t onLength = 0;
+    int32_t result = TELEPHONY_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindString(serial);
+        if (it == dtmfStrings_.end()) {
+            return;
+        }
+        DtmfString &entry = it->second;
+        if (!isAlive || entry.nextIndex >= entry.digits.size()) {
+            result = isAlive ? entry.result : CALL_ERR_CALL_STATE_MISMATCH_OPERATION;
+            dtmfStrings_.erase(it);
+        } else {
+            char c = entry.digits[entry.nextIndex++];
+            if (IsPauseChar(c)) {
+                SendEvent(DTMF_TONE_START_EVENT, static_cast<int64_t>(serial), DTMF_PAUSE_LENGTH);
+                return;
+            }
+            if (IsWaitChar(c)) {
+                TELEPHONY_LOGI("dtmf string is waiting, callId:%{public}d", callId);
+                entry.isWaiting = true;
+                return;
+            }
+            callInfo = entry.callInfo;
+            digit = c;
+            onLength = entry.onLength;
+        }
+    }
+    if (digit == '\0') {
+        ReportStringDone(callId, result);
+        return;
+    }
+    int32_t ret = DelayedSingleton<CellularCallConnection>::GetInstance()->StartStreamedDtmf(digit, callInfo);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("StartDtmf failed, return:%{public}d", ret);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindString(serial);
+        if (it != dtmfStrings_.end() && it->second.result == TELEPHONY_SUCCESS) {
+            it->second.result = ret;
+        }
+    }
+    // digits without a local tone, e.g. '*' and '#', are sent to the network only
+    if (DelayedSingleton<AudioControlManager>::GetInstance()->PlayDtmfTone(digit) == TELEPHONY_SUCCESS) {
+        toneSerial_ = serial;
+    }
+    SendEvent(DTMF_TONE_STOP_EVENT, static_cast<int64_t>(serial), onLength);
+}
+
+void CellularCallDtmfSender::StopTone(uint64_t serial)
+{
+    if (toneSerial_ == serial) {
+        (void)DelayedSingleton<AudioControlManager>::GetInstance()->StopDtmfTone();
+        toneSerial_ = 0;
+    }
+    CellularCallInfo callInfo;
+    int32_t offLength = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindString(serial);
+        if (it == dtmfStrings_.end()) {
+            return;
+        }
+        callInfo = it->second.callInfo;
+        offLength = it->second.offLength;
+    }
+    int32_t ret = DelayedSingleton<CellularCallConnection>::GetInstance()->StopStreamedDtmf(callInfo);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("StopDtmf failed, return:%{public}d", ret);
+    }
+    int32_t result = TELEPHONY_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindString(serial);
+        if (it == dtmfStrings_.end()) {
+            return;
+        }
+        if (ret != TELEPHONY_SUCCESS && it->second.result == TELEPHONY_SUCCESS) {
+            it->second.result = ret;
+        }
+        if (it->second.nextIndex < it->second.digits.size()) {
+            SendEvent(DTMF_TONE_START_EVENT, static_cast<int64_t>(serial), offLength);
+            return;
+        }
+        result = it->second.result;
+        dtmfStrings_.erase(it);
+    }
+    ReportStringDone(callInfo.callId, result);
+}
+
+std::map<int32_t, CellularCallDtmfSender::DtmfString>::iterator CellularCallDtmfSender::FindString(uint64_t serial)
+{
+    // a call has at most one string and there are only a few calls
+    for (auto it = dtmfStrings_.begin(); it != dtmfStrings_.end(); ++it) {
+        if (it->second.serial == serial) {
+            return it;
+        }
+    }
+    return dtmfStrings_.end();
+}
+
+void CellularCallDtmfSender::ReportStringDone(int32_t callId, int32_t result)
+{
+    AppExecFwk::PacMap resultInfo;
+    resultInfo.PutIntValue("callId", callId);
+    resultInfo.PutIntValue("result", result);
+    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(
+        CallResultReportId::SEND_DTMF_STRING_REPORT_ID, resultInfo);
+}
+
+bool CellularCallDtmfSender::IsCallAlive(int32_t callId)
+{
+    sptr<CallBase> call = CallObjectManager::GetOneCallObject(callId);
+    return call != nullptr && call->IsAliveState();
+}
+
+bool CellularCallDtmfSender::IsSameCall(const CellularCallInfo &callInfo, const CellularCallInfo &otherCallInfo)
+{
+    return callInfo.slotId == otherCallInfo.slotId && callInfo.index == otherCallInfo.index &&
+        callInfo.callType == otherCallInfo.callType;
+}
+
+bool CellularCallDtmfSender::IsDtmfDigit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'D') || c == '*' || c == '#';
+}
+
+bool CellularCallDtmfSender::IsPauseChar(char c)
+{
+    return c == 'P' || c == 'p' || c == ',';
+}
+
+bool CellularCallDtmfSender::IsWaitChar(char c)
+{
+    return c == 'W' || c == 'w' || c == ';';
+}
+} // namespace Telephony
+} // namespace OHOS
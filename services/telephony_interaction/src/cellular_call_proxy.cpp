@@ -14,159 +14,188 @@
  */
 
 #include "cellular_call_proxy.h"
+
+#include <memory>
+#include <type_traits>
+
 #include "call_manager_errors.h"
 
 namespace OHOS {
 namespace Telephony {
-int32_t CellularCallProxy::Dial(const CellularCallInfo &callInfo)
-{
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+namespace {
+/**
+ * request parcel shared by all requests of one thread, it keeps its buffer between requests.
+ * A request sent while the parcel of its thread is still in use, e.g. from a nested transaction,
+ * gets a parcel of its own.
+ */
+thread_local MessageParcel g_requestParcel;
+thread_local bool g_isRequestParcelBusy = false;
+
+class RequestParcelHolder {
+public:
+    RequestParcelHolder() : isShared_(!g_isRequestParcelBusy)
+    {
+        if (isShared_) {
+            g_isRequestParcelBusy = true;
+            g_requestParcel.RewindRead(0);
+            g_requestParcel.RewindWrite(0);
+        } else {
+            localParcel_ = std::make_unique<MessageParcel>();
+        }
     }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+
+    ~RequestParcelHolder()
+    {
+        if (isShared_) {
+            g_isRequestParcelBusy = false;
+        }
     }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::DIAL), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
+
+    MessageParcel &GetParcel()
+    {
+        return isShared_ ? g_requestParcel : *localParcel_;
     }
-    return error;
+
+private:
+    bool isShared_;
+    std::unique_ptr<MessageParcel> localParcel_;
+};
+
+bool WriteRequestArg(MessageParcel &in, int32_t value)
+{
+    return in.WriteInt32(value);
 }
 
-int32_t CellularCallProxy::HangUp(const CellularCallInfo &callInfo, CallSupplementType type)
+bool WriteRequestArg(MessageParcel &in, bool value)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
+    return in.WriteBool(value);
+}
+
+bool WriteRequestArg(MessageParcel &in, float value)
+{
+    return in.WriteFloat(value);
+}
+
+bool WriteRequestArg(MessageParcel &in, const char *value)
+{
+    return in.WriteCString(value);
+}
+
+bool WriteRequestArg(MessageParcel &in, const std::string &value)
+{
+    return in.WriteString(value);
+}
+
+bool WriteRequestArg(MessageParcel &in, const std::u16string &value)
+{
+    return in.WriteString16(value);
+}
+
+bool WriteRequestArg(MessageParcel &in, const std::vector<std::string> &value)
+{
+    return in.WriteStringVector(value);
+}
+
+template<typename T, std::enable_if_t<std::is_enum<T>::value, int> = 0>
+bool WriteRequestArg(MessageParcel &in, T value)
+{
+    return in.WriteInt32(static_cast<int32_t>(value));
+}
+
+// CellularCallInfo and the other plain structs are read back by the stub with ReadRawData
+template<typename T, std::enable_if_t<std::is_class<T>::value && std::is_trivially_copyable<T>::value, int> = 0>
+bool WriteRequestArg(MessageParcel &in, const T &value)
+{
+    return in.WriteRawData(static_cast<const void *>(&value), sizeof(T));
+}
+} // namespace
+
+template<typename... Args>
+int32_t CellularCallProxy::TransactCellularRequest(OperationType type, MessageParcel &out, const Args &...args)
+{
+    RequestParcelHolder holder;
+    MessageParcel &in = holder.GetParcel();
     if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
         return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
     }
-    if (!in.WriteInt32(MAX_SIZE)) {
+    if (!in.WriteInt32(MAX_SIZE) || !(WriteRequestArg(in, args) && ...)) {
         return TELEPHONY_ERR_WRITE_DATA_FAIL;
     }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    bool isOneWay = isOneWayRequestEnabled_ && IsOneWayRequest(type);
+    MessageOption option(isOneWay ? MessageOption::TF_ASYNC : MessageOption::TF_SYNC);
+    return Remote()->SendRequest(static_cast<uint32_t>(type), in, out, option);
+}
+
+template<typename... Args>
+int32_t CellularCallProxy::SendCellularRequest(OperationType type, const Args &...args)
+{
+    // the reply is not reused, it holds the transaction buffer of the driver until it is destroyed
+    MessageParcel out;
+    int32_t error = TransactCellularRequest(type, out, args...);
+    if (error != ERR_NONE) {
+        return error;
     }
-    if (!in.WriteInt32((int32_t)type)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    if (isOneWayRequestEnabled_ && IsOneWayRequest(type)) {
+        return TELEPHONY_SUCCESS;
     }
+    return out.ReadInt32();
+}
 
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::HANG_UP), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
+/**
+ * only the supplementary service setters, whose arguments CallSettingManager checks before they are sent,
+ * are one-way. DTMF and the IMS settings depend on the call and IMS state of the service, which rejects
+ * them synchronously, so they wait for its answer and a rejection reaches the app at once.
+ */
+bool CellularCallProxy::IsOneWayRequest(OperationType type)
+{
+    switch (type) {
+        case OperationType::SET_CALL_WAITING:
+        case OperationType::SET_CALL_RESTRICTION:
+        case OperationType::SET_CALL_TRANSFER:
+            return true;
+        default:
+            return false;
     }
-    return error;
+}
+
+void CellularCallProxy::SetOneWayRequestEnabled(bool enabled)
+{
+    isOneWayRequestEnabled_ = enabled;
+}
+
+int32_t CellularCallProxy::Dial(const CellularCallInfo &callInfo)
+{
+    return SendCellularRequest(OperationType::DIAL, callInfo);
+}
+
+int32_t CellularCallProxy::HangUp(const CellularCallInfo &callInfo, CallSupplementType type)
+{
+    return SendCellularRequest(OperationType::HANG_UP, callInfo, type);
 }
 
 int32_t CellularCallProxy::Reject(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::REJECT), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::REJECT, callInfo);
 }
 
 int32_t CellularCallProxy::Answer(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::ANSWER), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::ANSWER, callInfo);
 }
 
 int32_t CellularCallProxy::HoldCall(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::HOLD_CALL), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::HOLD_CALL, callInfo);
 }
 
 int32_t CellularCallProxy::UnHoldCall(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::UN_HOLD_CALL), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::UN_HOLD_CALL, callInfo);
 }
 
 int32_t CellularCallProxy::SwitchCall(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SWITCH_CALL), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SWITCH_CALL, callInfo);
 }
 
 int32_t CellularCallProxy::RegisterCallManagerCallBack(const sptr<ICallStatusCallback> &callback)
@@ -197,43 +226,13 @@ int32_t CellularCallProxy::RegisterCallManagerCallBack(const sptr<ICallStatusCal
 
 int32_t CellularCallProxy::UnRegisterCallManagerCallBack()
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::UNREGISTER_CALLBACK), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::UNREGISTER_CALLBACK);
 }
 
 int32_t CellularCallProxy::IsEmergencyPhoneNumber(int32_t slotId, const std::string &phoneNum, int32_t &errorCode)
 {
-    MessageOption option;
-    MessageParcel in;
     MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteString(phoneNum)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(errorCode)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t ret = Remote()->SendRequest(static_cast<uint32_t>(OperationType::EMERGENCY_CALL), in, out, option);
+    int32_t ret = TransactCellularRequest(OperationType::EMERGENCY_CALL, out, slotId, phoneNum, errorCode);
     if (ret == ERR_NONE) {
         ret = out.ReadInt32();
         errorCode = out.ReadInt32();
@@ -243,863 +242,184 @@ int32_t CellularCallProxy::IsEmergencyPhoneNumber(int32_t slotId, const std::str
 
 int32_t CellularCallProxy::CombineConference(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::COMBINE_CONFERENCE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::COMBINE_CONFERENCE, callInfo);
 }
 
 int32_t CellularCallProxy::SeparateConference(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SEPARATE_CONFERENCE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SEPARATE_CONFERENCE, callInfo);
 }
 
 int32_t CellularCallProxy::InviteToConference(int32_t slotId, const std::vector<std::string> &numberList)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteStringVector(numberList)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::INVITE_TO_CONFERENCE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::INVITE_TO_CONFERENCE, slotId, numberList);
 }
 
 int32_t CellularCallProxy::KickOutFromConference(int32_t slotId, const std::vector<std::string> &numberList)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteStringVector(numberList)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::KICK_OUT_CONFERENCE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::KICK_OUT_CONFERENCE, slotId, numberList);
 }
 
 int32_t CellularCallProxy::HangUpAllConnection()
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::HANG_UP_ALL_CONNECTION), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::HANG_UP_ALL_CONNECTION);
 }
 
 int32_t CellularCallProxy::UpdateImsCallMode(const CellularCallInfo &callInfo, ImsCallMode mode)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32((int32_t)mode)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::UPDATE_CALL_MEDIA_MODE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::UPDATE_CALL_MEDIA_MODE, callInfo, mode);
 }
 
 int32_t CellularCallProxy::StartDtmf(char cDtmfCode, const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteCString(&cDtmfCode)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::START_DTMF), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    const char dtmfCode[] = { cDtmfCode, '\0' };
+    return SendCellularRequest(OperationType::START_DTMF, dtmfCode, callInfo);
 }
 
 int32_t CellularCallProxy::StopDtmf(const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::STOP_DTMF), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::STOP_DTMF, callInfo);
 }
 
 int32_t CellularCallProxy::SendDtmf(char cDtmfCode, const CellularCallInfo &callInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteCString(&cDtmfCode)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SEND_DTMF), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    const char dtmfCode[] = { cDtmfCode, '\0' };
+    return SendCellularRequest(OperationType::SEND_DTMF, dtmfCode, callInfo);
 }
 
 int32_t CellularCallProxy::StartRtt(int32_t slotId, const std::string &msg)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteString(msg)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::START_RTT), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::START_RTT, slotId, msg);
 }
 
 int32_t CellularCallProxy::StopRtt(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::STOP_RTT), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::STOP_RTT, slotId);
 }
 
 int32_t CellularCallProxy::SetCallTransferInfo(int32_t slotId, const CallTransferInfo &ctInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&ctInfo, sizeof(CallTransferInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_CALL_TRANSFER), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_CALL_TRANSFER, slotId, ctInfo);
 }
 
 int32_t CellularCallProxy::GetCallTransferInfo(int32_t slotId, CallTransferType type)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32((int32_t)type)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_CALL_TRANSFER), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_CALL_TRANSFER, slotId, type);
 }
 
 int32_t CellularCallProxy::SetCallWaiting(int32_t slotId, bool activate)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteBool(activate)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_CALL_WAITING), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_CALL_WAITING, slotId, activate);
 }
 
 int32_t CellularCallProxy::GetCallWaiting(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_CALL_WAITING), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_CALL_WAITING, slotId);
 }
 
 int32_t CellularCallProxy::SetCallRestriction(int32_t slotId, const CallRestrictionInfo &crInfo)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteRawData((const void *)&crInfo, sizeof(CallRestrictionInfo))) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_CALL_RESTRICTION), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_CALL_RESTRICTION, slotId, crInfo);
 }
 
 int32_t CellularCallProxy::GetCallRestriction(int32_t slotId, CallRestrictionType facType)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32((int32_t)facType)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_CALL_RESTRICTION), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_CALL_RESTRICTION, slotId, facType);
 }
 
 int32_t CellularCallProxy::SetDomainPreferenceMode(int32_t slotId, int32_t mode)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(mode)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_DOMAIN_PREFERENCE_MODE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_DOMAIN_PREFERENCE_MODE, slotId, mode);
 }
 
 int32_t CellularCallProxy::GetDomainPreferenceMode(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_DOMAIN_PREFERENCE_MODE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_DOMAIN_PREFERENCE_MODE, slotId);
 }
 
 int32_t CellularCallProxy::SetLteImsSwitchStatus(int32_t slotId, bool active)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteBool(active)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_LTE_IMS_SWITCH_STATUS), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_LTE_IMS_SWITCH_STATUS, slotId, active);
 }
 
 int32_t CellularCallProxy::GetLteImsSwitchStatus(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_LTE_IMS_SWITCH_STATUS), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_LTE_IMS_SWITCH_STATUS, slotId);
 }
 
 int32_t CellularCallProxy::SetImsConfig(int32_t slotId, ImsConfigItem item, const std::string &value)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(item)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteString(value)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_IMS_CONFIG_STRING), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_IMS_CONFIG_STRING, slotId, item, value);
 }
 
 int32_t CellularCallProxy::SetImsConfig(int32_t slotId, ImsConfigItem item, int32_t value)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(item)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(value)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_IMS_CONFIG_INT), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_IMS_CONFIG_INT, slotId, item, value);
 }
 
 int32_t CellularCallProxy::GetImsConfig(int32_t slotId, ImsConfigItem item)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(item)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_IMS_CONFIG), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_IMS_CONFIG, slotId, item);
 }
 
 int32_t CellularCallProxy::SetImsFeatureValue(int32_t slotId, FeatureType type, int32_t value)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(type)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(value)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_IMS_FEATURE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_IMS_FEATURE, slotId, type, value);
 }
 
 int32_t CellularCallProxy::GetImsFeatureValue(int32_t slotId, FeatureType type)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(type)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_IMS_FEATURE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_IMS_FEATURE, slotId, type);
 }
 
 int32_t CellularCallProxy::SetImsSwitchEnhanceMode(int32_t slotId, bool value)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteBool(value)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_IMS_SWITCH_ENHANCE_MODE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_IMS_SWITCH_ENHANCE_MODE, slotId, value);
 }
 
 int32_t CellularCallProxy::GetImsSwitchEnhanceMode(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error =
-        Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_IMS_SWITCH_ENHANCE_MODE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_IMS_SWITCH_ENHANCE_MODE, slotId);
 }
 
 int32_t CellularCallProxy::CtrlCamera(const std::u16string &cameraId, int32_t callingUid, int32_t callingPid)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteString16(cameraId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(callingUid)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(callingPid)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::CTRL_CAMERA), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::CTRL_CAMERA, cameraId, callingUid, callingPid);
 }
 
 int32_t CellularCallProxy::SetPreviewWindow(int32_t x, int32_t y, int32_t z, int32_t width, int32_t height)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(x)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(y)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(z)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(width)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(height)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_PREVIEW_WINDOW), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_PREVIEW_WINDOW, x, y, z, width, height);
 }
 
 int32_t CellularCallProxy::SetDisplayWindow(int32_t x, int32_t y, int32_t z, int32_t width, int32_t height)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(x)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(y)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(z)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(width)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(height)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_DISPLAY_WINDOW), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_DISPLAY_WINDOW, x, y, z, width, height);
 }
 
 int32_t CellularCallProxy::SetCameraZoom(float zoomRatio)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteFloat(zoomRatio)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_CAMERA_ZOOM), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_CAMERA_ZOOM, zoomRatio);
 }
 
 int32_t CellularCallProxy::SetPauseImage(const std::u16string &path)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteString16(path)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_PAUSE_IMAGE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_PAUSE_IMAGE, path);
 }
 
 int32_t CellularCallProxy::SetDeviceDirection(int32_t rotation)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(rotation)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_DEVICE_DIRECTION), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_DEVICE_DIRECTION, rotation);
 }
 
 int32_t CellularCallProxy::SetMute(int32_t slotId, int32_t mute)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(mute)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::SET_MUTE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::SET_MUTE, slotId, mute);
 }
 
 int32_t CellularCallProxy::GetMute(int32_t slotId)
 {
-    MessageOption option;
-    MessageParcel in;
-    MessageParcel out;
-    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
-        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
-    }
-    if (!in.WriteInt32(MAX_SIZE)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    if (!in.WriteInt32(slotId)) {
-        return TELEPHONY_ERR_WRITE_DATA_FAIL;
-    }
-    int32_t error = Remote()->SendRequest(static_cast<uint32_t>(OperationType::GET_MUTE), in, out, option);
-    if (error == ERR_NONE) {
-        return out.ReadInt32();
-    }
-    return error;
+    return SendCellularRequest(OperationType::GET_MUTE, slotId);
 }
 } // namespace Telephony
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "cellular_call_request_tracker.h"
+
+#include "call_manager_errors.h"
+#include "telephony_log_wrapper.h"
+
+#include "call_ability_report_proxy.h"
+
+namespace OHOS {
+namespace Telephony {
+CellularCallRequestTracker::CellularCallRequestTracker(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
+    : AppExecFwk::EventHandler(runner)
+{}
+
+uint64_t CellularCallRequestTracker::AddRequest(CallResultReportId reportId, bool isReported)
+{
+    size_t index = static_cast<size_t>(reportId);
+    if (index >= CALL_RESULT_REPORT_ID_NUM) {
+        return 0;
+    }
+    uint64_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requestId = nextRequestId_++;
+        pendingRequests_[index].push_back({requestId, std::chrono::steady_clock::now(), isReported});
+    }
+    AppExecFwk::InnerEvent::Pointer event =
+        AppExecFwk::InnerEvent::Get(static_cast<uint32_t>(index), static_cast<int64_t>(requestId));
+    if (!SendEvent(event, GetRequestTimeout(index))) {
+        TELEPHONY_LOGE("send timeout event failed, reportId:%{public}zu", index);
+    }
+    return requestId;
+}
+
+void CellularCallRequestTracker::RemoveRequest(CallResultReportId reportId, uint64_t requestId)
+{
+    size_t index = static_cast<size_t>(reportId);
+    if (index >= CALL_RESULT_REPORT_ID_NUM) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool isReported = false;
+    (void)EraseRequest(index, requestId, isReported);
+}
+
+bool CellularCallRequestTracker::OnResultReceived(CallResultReportId reportId)
+{
+    size_t index = static_cast<size_t>(reportId);
+    if (index >= CALL_RESULT_REPORT_ID_NUM) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    DropExpiredLateResults(index);
+    if (!lateResultDeadlines_[index].empty()) {
+        // results of a report id come in request order, this one belongs to a request that timed out
+        lateResultDeadlines_[index].pop_front();
+        return false;
+    }
+    std::deque<PendingRequest> &requests = pendingRequests_[index];
+    if (requests.empty()) {
+        return false;
+    }
+    auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - requests.front().sendTime);
+    TELEPHONY_LOGI("reportId:%{public}zu result after %{public}lld ms", index,
+        static_cast<long long>(latency.count()));
+    bool isReported = requests.front().isReported;
+    requests.pop_front();
+    return isReported;
+}
+
+bool CellularCallRequestTracker::HasRequest(CallResultReportId reportId)
+{
+    size_t index = static_cast<size_t>(reportId);
+    if (index >= CALL_RESULT_REPORT_ID_NUM) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    DropExpiredLateResults(index);
+    return !pendingRequests_[index].empty() || !lateResultDeadlines_[index].empty();
+}
+
+void CellularCallRequestTracker::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (event == nullptr) {
+        TELEPHONY_LOGE("CellularCallRequestTracker::ProcessEvent parameter error");
+        return;
+    }
+    size_t index = static_cast<size_t>(event->GetInnerEventId());
+    if (index >= CALL_RESULT_REPORT_ID_NUM) {
+        return;
+    }
+    bool isReported = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!EraseRequest(index, static_cast<uint64_t>(event->GetParam()), isReported)) {
+            return;
+        }
+        lateResultDeadlines_[index].push_back(
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(GetRequestTimeout(index)));
+    }
+    TELEPHONY_LOGE("cellular call request timeout, reportId:%{public}zu", index);
+    if (!isReported) {
+        return;
+    }
+    ReportRequestFailed(index, CALL_ERR_CELLULAR_CALL_RESPONSE_TIMEOUT);
+}
+
+void CellularCallRequestTracker::Reset()
+{
+    size_t failedNum[CALL_RESULT_REPORT_ID_NUM] = {};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t index = 0; index < CALL_RESULT_REPORT_ID_NUM; index++) {
+            for (const PendingRequest &request : pendingRequests_[index]) {
+                failedNum[index] += request.isReported ? 1 : 0;
+            }
+            pendingRequests_[index].clear();
+            lateResultDeadlines_[index].clear();
+        }
+    }
+    // their timeout events find nothing left and report nothing more
+    for (size_t index = 0; index < CALL_RESULT_REPORT_ID_NUM; index++) {
+        for (size_t i = 0; i < failedNum[index]; i++) {
+            ReportRequestFailed(index, TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL);
+        }
+    }
+}
+
+int64_t CellularCallRequestTracker::GetRequestTimeout(size_t index)
+{
+    switch (static_cast<CallResultReportId>(index)) {
+        case CallResultReportId::SET_CALL_WAITING_REPORT_ID:
+        case CallResultReportId::SET_CALL_RESTRICTION_REPORT_ID:
+        case CallResultReportId::SET_CALL_TRANSFER_REPORT_ID:
+            return CELLULAR_CALL_SS_REQUEST_TIMEOUT_MS;
+        default:
+            return CELLULAR_CALL_ASYNC_REQUEST_TIMEOUT_MS;
+    }
+}
+
+// a timed out request that got no result within another timeout is taken as never answered
+void CellularCallRequestTracker::DropExpiredLateResults(size_t index)
+{
+    std::deque<std::chrono::steady_clock::time_point> &deadlines = lateResultDeadlines_[index];
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    while (!deadlines.empty() && deadlines.front() <= now) {
+        deadlines.pop_front();
+    }
+}
+
+void CellularCallRequestTracker::ReportRequestFailed(size_t index, int32_t result)
+{
+    AppExecFwk::PacMap resultInfo;
+    resultInfo.PutIntValue("result", result);
+    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAsyncResults(
+        static_cast<CallResultReportId>(index), resultInfo);
+}
+
+bool CellularCallRequestTracker::EraseRequest(size_t index, uint64_t requestId, bool &isReported)
+{
+    std::deque<PendingRequest> &requests = pendingRequests_[index];
+    for (auto it = requests.begin(); it != requests.end(); ++it) {
+        if (it->requestId == requestId) {
+            isReported = it->isReported;
+            requests.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -17,26 +17,34 @@
 
 #include "call_manager_errors.h"
 #include "telephony_log_wrapper.h"
+#include "call_latency_tracer.h"
 #include "ims_call.h"
 
 namespace OHOS {
 namespace Telephony {
+// a call list report is keyed by its slot alone
+constexpr int32_t CALL_LIST_REPORT_INDEX = -1;
+constexpr int32_t CALL_REPORT_KEY_SLOT_SHIFT = 32;
+
+constexpr CallDispatchTable<ReportCallInfoHandler::CallManagerServiceFunc,
+    ReportCallInfoHandlerService::HANDLER_EVENT_NUM>
+    ReportCallInfoHandler::memberFuncTable_({
+        { ReportCallInfoHandlerService::HANDLER_UPDATE_CELLULAR_CALL_INFO, &ReportCallInfoHandler::ReportCallInfo },
+        { ReportCallInfoHandlerService::HANDLER_UPDATE_CALL_INFO_LIST, &ReportCallInfoHandler::ReportCallsInfo },
+        { ReportCallInfoHandlerService::HANDLER_UPDATE_DISCONNECTED_CAUSE,
+            &ReportCallInfoHandler::ReportDisconnectedCause },
+        { ReportCallInfoHandlerService::HANDLER_UPDATE_CELLULAR_EVENT_RESULT_INFO,
+            &ReportCallInfoHandler::ReportEventInfo },
+        { ReportCallInfoHandlerService::HANDLER_UPDATE_OTT_EVENT_RESULT_INFO, &ReportCallInfoHandler::ReportOttEvent },
+        { ReportCallInfoHandlerService::HANDLE_UPDATE_MEDIA_MODE_RESPONSE,
+            &ReportCallInfoHandler::OnUpdateMediaModeResponse },
+        { ReportCallInfoHandlerService::HANDLER_FLUSH_PENDING_CALL_REPORT,
+            &ReportCallInfoHandler::FlushPendingCallReport },
+    });
+
 ReportCallInfoHandler::ReportCallInfoHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
     : AppExecFwk::EventHandler(runner)
-{
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLER_UPDATE_CELLULAR_CALL_INFO] =
-        &ReportCallInfoHandler::ReportCallInfo;
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLER_UPDATE_CALL_INFO_LIST] =
-        &ReportCallInfoHandler::ReportCallsInfo;
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLER_UPDATE_DISCONNECTED_CAUSE] =
-        &ReportCallInfoHandler::ReportDisconnectedCause;
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLER_UPDATE_CELLULAR_EVENT_RESULT_INFO] =
-        &ReportCallInfoHandler::ReportEventInfo;
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLER_UPDATE_OTT_EVENT_RESULT_INFO] =
-        &ReportCallInfoHandler::ReportOttEvent;
-    memberFuncMap_[ReportCallInfoHandlerService::HANDLE_UPDATE_MEDIA_MODE_RESPONSE] =
-        &ReportCallInfoHandler::OnUpdateMediaModeResponse;
-}
+{}
 
 ReportCallInfoHandler::~ReportCallInfoHandler()
 {
@@ -61,13 +69,11 @@ void ReportCallInfoHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &
         TELEPHONY_LOGE("ReportCallInfoHandler::ProcessEvent parameter error");
         return;
     }
+    CallPerfStatistics::OnEventProcessed(CALL_EVENT_QUEUE_REPORT);
     TELEPHONY_LOGI("ReportCallInfoHandler::ProcessEvent inner event id: %{public}u.", event->GetInnerEventId());
-    auto itFunc = memberFuncMap_.find(event->GetInnerEventId());
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
-            return (this->*memberFunc)(event);
-        }
+    auto memberFunc = memberFuncTable_.Find(event->GetInnerEventId());
+    if (memberFunc != nullptr) {
+        return (this->*memberFunc)(event);
     }
 }
 
@@ -83,6 +89,8 @@ void ReportCallInfoHandler::ReportCallInfo(const AppExecFwk::InnerEvent::Pointer
         TELEPHONY_LOGE("callStatusManagerPtr_ is nullptr");
         return;
     }
+    CallLatencyTraceScope traceScope(event->GetParam());
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_REPORT_QUEUE);
     int32_t ret = callStatusManagerPtr_->HandleCallReportInfo(info);
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("HandleCallReportInfo failed! ret:%{public}d", ret);
@@ -103,6 +111,8 @@ void ReportCallInfoHandler::ReportCallsInfo(const AppExecFwk::InnerEvent::Pointe
         TELEPHONY_LOGE("callStatusManagerPtr_ is nullptr");
         return;
     }
+    CallLatencyTraceScope traceScope(event->GetParam());
+    CallLatencyTracer::MarkStage(CALL_LATENCY_STAGE_REPORT_QUEUE);
     int32_t ret = callStatusManagerPtr_->HandleCallsReportInfo(info);
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("HandleCallsReportInfo failed! ret:%{public}d", ret);
@@ -191,7 +201,20 @@ void ReportCallInfoHandler::OnUpdateMediaModeResponse(const AppExecFwk::InnerEve
     return;
 }
 
-ReportCallInfoHandlerService::ReportCallInfoHandlerService() : eventLoop_(nullptr), handler_(nullptr) {}
+void ReportCallInfoHandler::FlushPendingCallReport(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    auto object = event->GetUniqueObject<int64_t>();
+    if (object == nullptr) {
+        TELEPHONY_LOGE("object is nullptr!");
+        return;
+    }
+    DelayedSingleton<ReportCallInfoHandlerService>::GetInstance()->FlushPendingCallReport(*object);
+}
+
+ReportCallInfoHandlerService::ReportCallInfoHandlerService()
+    : coalesceWindowMs_(CALL_REPORT_COALESCE_WINDOW_DEFAULT_MS), suppressedReportNum_(0), eventLoop_(nullptr),
+      handler_(nullptr)
+{}
 
 ReportCallInfoHandlerService::~ReportCallInfoHandlerService()
 {
@@ -225,13 +248,31 @@ int32_t ReportCallInfoHandlerService::UpdateCallReportInfo(const CallDetailInfo
         TELEPHONY_LOGE("handler_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    if (coalesceWindowMs_ > 0 && IsCoalescableState(info.state)) {
+        PendingCallReport report;
+        report.info = info;
+        report.traceBeginTime = CallLatencyTracer::GetTraceBeginTime();
+        if (HoldPendingCallReport(GetCallReportKey(info.accountId, info.index), report)) {
+            return TELEPHONY_SUCCESS;
+        }
+        // the held reports of the slot are already sent ahead of this one
+        return SendCallReportInfo(info, report.traceBeginTime);
+    }
+    FlushAllPendingCallReportLocked();
+    return SendCallReportInfo(info, CallLatencyTracer::GetTraceBeginTime());
+}
+
+int32_t ReportCallInfoHandlerService::SendCallReportInfo(const CallDetailInfo &info, int64_t traceBeginTime)
+{
     std::unique_ptr<CallDetailInfo> para = std::make_unique<CallDetailInfo>();
     if (para.get() == nullptr) {
         TELEPHONY_LOGE("make_unique CallDetailInfo failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = info;
-    bool ret = handler_->SendEvent(HANDLER_UPDATE_CELLULAR_CALL_INFO, std::move(para));
+    bool ret = SendHandlerEvent(
+        AppExecFwk::InnerEvent::Get(HANDLER_UPDATE_CELLULAR_CALL_INFO, std::move(para), traceBeginTime));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! status update failed, state:%{public}d", info.state);
     }
@@ -244,13 +285,32 @@ int32_t ReportCallInfoHandlerService::UpdateCallsReportInfo(CallDetailsInfo &inf
         TELEPHONY_LOGE("handler_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    int64_t reportKey = GetCallReportKey(info.slotId, CALL_LIST_REPORT_INDEX);
+    if (coalesceWindowMs_ > 0 && IsCoalescableCallList(info, reportKey)) {
+        PendingCallReport report;
+        report.isCallList = true;
+        report.infoList = info;
+        report.traceBeginTime = CallLatencyTracer::GetTraceBeginTime();
+        if (HoldPendingCallReport(reportKey, report)) {
+            return TELEPHONY_SUCCESS;
+        }
+        return SendCallsReportInfo(info, report.traceBeginTime);
+    }
+    FlushAllPendingCallReportLocked();
+    return SendCallsReportInfo(info, CallLatencyTracer::GetTraceBeginTime());
+}
+
+int32_t ReportCallInfoHandlerService::SendCallsReportInfo(const CallDetailsInfo &info, int64_t traceBeginTime)
+{
     std::unique_ptr<CallDetailsInfo> para = std::make_unique<CallDetailsInfo>();
     if (para.get() == nullptr) {
         TELEPHONY_LOGE("make_unique CallDetailsInfo failed!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = info;
-    bool ret = handler_->SendEvent(HANDLER_UPDATE_CALL_INFO_LIST, std::move(para));
+    bool ret = SendHandlerEvent(
+        AppExecFwk::InnerEvent::Get(HANDLER_UPDATE_CALL_INFO_LIST, std::move(para), traceBeginTime));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! status update failed, slotId:%{public}d", info.slotId);
     }
@@ -269,7 +329,7 @@ int32_t ReportCallInfoHandlerService::UpdateDisconnectedCause(const Disconnected
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = static_cast<int32_t>(cause);
-    bool ret = handler_->SendEvent(HANDLER_UPDATE_DISCONNECTED_CAUSE, std::move(para));
+    bool ret = SendHandlerEvent(HANDLER_UPDATE_DISCONNECTED_CAUSE, std::move(para));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! DisconnectedDetails:%{public}d", cause);
     }
@@ -289,7 +349,7 @@ int32_t ReportCallInfoHandlerService::UpdateEventResultInfo(const CellularCallEv
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = info;
-    bool ret = handler_->SendEvent(HANDLER_UPDATE_CELLULAR_EVENT_RESULT_INFO, std::move(para));
+    bool ret = SendHandlerEvent(HANDLER_UPDATE_CELLULAR_EVENT_RESULT_INFO, std::move(para));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! eventType:%{public}d, eventId:%{public}d", info.eventType, info.eventId);
     }
@@ -308,7 +368,7 @@ int32_t ReportCallInfoHandlerService::UpdateOttEventInfo(const OttCallEventInfo
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     *para = info;
-    bool ret = handler_->SendEvent(HANDLER_UPDATE_OTT_EVENT_RESULT_INFO, std::move(para));
+    bool ret = SendHandlerEvent(HANDLER_UPDATE_OTT_EVENT_RESULT_INFO, std::move(para));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! eventId:%{public}d", info.ottCallEventId);
     }
@@ -331,11 +391,162 @@ int32_t ReportCallInfoHandlerService::UpdateMediaModeResponse(const CallMediaMod
         return TELEPHONY_ERR_MEMSET_FAIL;
     }
     para->result = response.result;
-    bool ret = handler_->SendEvent(HANDLE_UPDATE_MEDIA_MODE_RESPONSE, std::move(para));
+    bool ret = SendHandlerEvent(HANDLE_UPDATE_MEDIA_MODE_RESPONSE, std::move(para));
     if (!ret) {
         TELEPHONY_LOGE("SendEvent failed! errno: %{public}d", ret);
     }
     return TELEPHONY_SUCCESS;
 }
+
+bool ReportCallInfoHandlerService::SetCallReportCoalesceWindow(int64_t windowMs)
+{
+    if (windowMs < 0 || windowMs > CALL_REPORT_COALESCE_WINDOW_MAX_MS) {
+        TELEPHONY_LOGE("invalid coalesce window:%{public}lld(milliseconds)", static_cast<long long>(windowMs));
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    coalesceWindowMs_ = windowMs;
+    if (coalesceWindowMs_ == 0) {
+        FlushAllPendingCallReportLocked();
+    }
+    TELEPHONY_LOGI("call report coalesce window:%{public}lld(milliseconds)", static_cast<long long>(windowMs));
+    return true;
+}
+
+int64_t ReportCallInfoHandlerService::GetCallReportCoalesceWindow()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    return coalesceWindowMs_;
+}
+
+int64_t ReportCallInfoHandlerService::GetSuppressedCallReportNum()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    return suppressedReportNum_;
+}
+
+void ReportCallInfoHandlerService::FlushPendingCallReport(int64_t reportKey)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto iter = pendingReportMap_.find(reportKey);
+    if (iter == pendingReportMap_.end()) {
+        // already sent ahead of a report that can not be held
+        return;
+    }
+    if (iter->second.isHeld) {
+        SendPendingCallReportLocked(iter->second);
+    }
+    pendingReportMap_.erase(iter);
+}
+
+bool ReportCallInfoHandlerService::IsCoalescableState(TelCallState state)
+{
+    // dialing creates the call and incoming, waiting and disconnected start or end its lifecycle
+    switch (state) {
+        case TelCallState::CALL_STATUS_ACTIVE:
+        case TelCallState::CALL_STATUS_HOLDING:
+        case TelCallState::CALL_STATUS_ALERTING:
+        case TelCallState::CALL_STATUS_DISCONNECTING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ReportCallInfoHandlerService::IsCoalescableCallList(const CallDetailsInfo &info, int64_t reportKey)
+{
+    if (info.callVec.empty()) {
+        return false;
+    }
+    for (auto &callInfo : info.callVec) {
+        if (!IsCoalescableState(callInfo.state)) {
+            return false;
+        }
+    }
+    auto iter = pendingReportMap_.find(reportKey);
+    if (iter == pendingReportMap_.end() || !iter->second.isHeld) {
+        return true;
+    }
+    // a call that appears or vanishes between the two lists would never be seen, so only the states may differ
+    const std::vector<CallDetailInfo> &pendingVec = iter->second.infoList.callVec;
+    if (pendingVec.size() != info.callVec.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < pendingVec.size(); ++i) {
+        if (pendingVec[i].index != info.callVec[i].index) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * returns false if the report has to be sent now, which is the case for the first report of a window.
+ */
+bool ReportCallInfoHandlerService::HoldPendingCallReport(int64_t reportKey, PendingCallReport &report)
+{
+    FlushSlotPendingCallReportLocked(reportKey);
+    auto iter = pendingReportMap_.find(reportKey);
+    if (iter != pendingReportMap_.end()) {
+        if (iter->second.isHeld) {
+            ++suppressedReportNum_;
+        }
+        iter->second = std::move(report);
+        iter->second.isHeld = true;
+        return true;
+    }
+    std::unique_ptr<int64_t> para = std::make_unique<int64_t>(reportKey);
+    if (para.get() == nullptr) {
+        TELEPHONY_LOGE("make_unique int64_t failed!");
+        return false;
+    }
+    if (!SendHandlerEvent(HANDLER_FLUSH_PENDING_CALL_REPORT, std::move(para), coalesceWindowMs_)) {
+        TELEPHONY_LOGE("SendEvent failed! the report is sent without coalescing");
+        return false;
+    }
+    pendingReportMap_.emplace(reportKey, PendingCallReport());
+    return false;
+}
+
+void ReportCallInfoHandlerService::SendPendingCallReportLocked(const PendingCallReport &report)
+{
+    // a held report keeps the begin time of its newest report, the replaced ones never reach the apps
+    if (report.isCallList) {
+        SendCallsReportInfo(report.infoList, report.traceBeginTime);
+    } else {
+        SendCallReportInfo(report.info, report.traceBeginTime);
+    }
+}
+
+/**
+ * sends the held reports of the other calls and the call list of the slot of reportKey, their windows
+ * stay open. The keys of one slot are adjacent in the map since the slot is in the high bits.
+ */
+void ReportCallInfoHandlerService::FlushSlotPendingCallReportLocked(int64_t reportKey)
+{
+    int64_t slotKey = reportKey >> CALL_REPORT_KEY_SLOT_SHIFT;
+    for (auto iter = pendingReportMap_.lower_bound(slotKey << CALL_REPORT_KEY_SLOT_SHIFT);
+         iter != pendingReportMap_.end() && (iter->first >> CALL_REPORT_KEY_SLOT_SHIFT) == slotKey; ++iter) {
+        if (iter->first != reportKey && iter->second.isHeld) {
+            SendPendingCallReportLocked(iter->second);
+            iter->second = PendingCallReport();
+        }
+    }
+}
+
+void ReportCallInfoHandlerService::FlushAllPendingCallReportLocked()
+{
+    for (auto &pendingReport : pendingReportMap_) {
+        if (pendingReport.second.isHeld) {
+            SendPendingCallReportLocked(pendingReport.second);
+        }
+    }
+    pendingReportMap_.clear();
+}
+
+int64_t ReportCallInfoHandlerService::GetCallReportKey(int32_t slotId, int32_t index)
+{
+    return (static_cast<int64_t>(slotId) << CALL_REPORT_KEY_SLOT_SHIFT) | static_cast<uint32_t>(index);
+}
 } // namespace Telephony
 } // namespace OHOS
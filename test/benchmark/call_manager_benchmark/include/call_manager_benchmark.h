@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_MANAGER_BENCHMARK_H
+#define CALL_MANAGER_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "call_base.h"
+#include "common_type.h"
+
+namespace OHOS {
+namespace Telephony {
+// live call counts the registry benchmarks run with, bounded by the call id space
+const std::vector<int64_t> BENCHMARK_CALL_NUM_LIST = { 1, 2, 4, 8, 16, 32, CALL_ID_SPACE_SIZE - 1 };
+constexpr int32_t BENCHMARK_MAX_THREAD_NUM = 16;
+constexpr size_t LATENCY_SAMPLE_NUM = 8192;
+constexpr double PERCENT_50 = 0.5;
+constexpr double PERCENT_99 = 0.99;
+
+/**
+ * fills the call registry with callNum CS calls spread over both slots; the first call is put into firstState,
+ * the others alternate between active and holding
+ */
+void SetUpRegistryCalls(int64_t callNum, TelCallState firstState);
+void TearDownRegistryCalls();
+// number of operator new calls of the whole process so far
+uint64_t GetHeapAllocCount();
+
+/**
+ * @ClassName:LatencyRecorder
+ * @Description:keeps the latest LATENCY_SAMPLE_NUM latencies of one benchmark thread
+ * and reports their percentiles as benchmark counters.
+ */
+class LatencyRecorder {
+public:
+    LatencyRecorder() : sampleCount_(0)
+    {
+        samples_.resize(LATENCY_SAMPLE_NUM);
+    }
+    ~LatencyRecorder() = default;
+
+    template<typename Function>
+    void Measure(Function function)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        samples_[sampleCount_ % LATENCY_SAMPLE_NUM] =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        ++sampleCount_;
+    }
+
+    void Report(benchmark::State &state)
+    {
+        size_t num = std::min(sampleCount_, LATENCY_SAMPLE_NUM);
+        if (num == 0) {
+            return;
+        }
+        std::vector<int64_t> sorted(samples_.begin(), samples_.begin() + num);
+        std::sort(sorted.begin(), sorted.end());
+        // counters of all threads are averaged, so the percentiles stay comparable across thread counts
+        state.counters["p50_ns"] = benchmark::Counter(
+            static_cast<double>(sorted[static_cast<size_t>((num - 1) * PERCENT_50)]), benchmark::Counter::kAvgThreads);
+        state.counters["p99_ns"] = benchmark::Counter(
+            static_cast<double>(sorted[static_cast<size_t>((num - 1) * PERCENT_99)]), benchmark::Counter::kAvgThreads);
+        state.counters["max_ns"] =
+            benchmark::Counter(static_cast<double>(sorted[num - 1]), benchmark::Counter::kAvgThreads);
+    }
+
+private:
+    std::vector<int64_t> samples_;
+    size_t sampleCount_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_MANAGER_BENCHMARK_H
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+// the baseline is always written as json, arguments given on the command line take precedence
+char g_defaultOutArg[] = "--benchmark_out=/data/local/tmp/tel_call_manager_benchmark.json";
+char g_defaultOutFormatArg[] = "--benchmark_out_format=json";
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::vector<char *> args;
+    args.emplace_back(argv[0]);
+    args.emplace_back(g_defaultOutArg);
+    args.emplace_back(g_defaultOutFormatArg);
+    for (int i = 1; i < argc; ++i) {
+        args.emplace_back(argv[i]);
+    }
+    int argNum = static_cast<int>(args.size());
+    benchmark::Initialize(&argNum, args.data());
+    if (benchmark::ReportUnrecognizedArguments(argNum, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
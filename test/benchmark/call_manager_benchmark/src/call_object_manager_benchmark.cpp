@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "call_manager_benchmark.h"
+
+#include "call_object_manager.h"
+#include "call_policy.h"
+#include "cs_call.h"
+
+namespace OHOS {
+namespace Telephony {
+const std::string REGISTRY_PHONE_NUMBER_PREFIX = "1380000";
+constexpr int32_t REGISTRY_SLOT_NUM = 2;
+
+// calls the registry benchmarks run against, written by thread 0 before the measured loop starts
+static std::vector<sptr<CallBase>> g_callList;
+
+static CallPolicy &GetCallPolicy()
+{
+    // constructed once and before the calls are added, the constructor clears the shared registry
+    static CallPolicy callPolicy;
+    return callPolicy;
+}
+
+static std::string GetCallNumber(int32_t index)
+{
+    return REGISTRY_PHONE_NUMBER_PREFIX + std::to_string(index);
+}
+
+void SetUpRegistryCalls(int64_t callNum, TelCallState firstState)
+{
+    GetCallPolicy();
+    g_callList.clear();
+    for (int32_t i = 0; i < static_cast<int32_t>(callNum); ++i) {
+        DialParaInfo info;
+        info.callId = CallObjectManager::GetNewCallId();
+        info.accountId = i % REGISTRY_SLOT_NUM;
+        info.index = i + 1;
+        info.number = GetCallNumber(i);
+        info.callType = CallType::TYPE_CS;
+        info.callState = TelCallState::CALL_STATUS_IDLE;
+        sptr<CallBase> call = new CSCall(info);
+        if (CallObjectManager::AddOneCallObject(call) != TELEPHONY_SUCCESS) {
+            continue;
+        }
+        if (i == 0) {
+            call->SetTelCallState(firstState);
+        } else if (i % REGISTRY_SLOT_NUM == 0) {
+            call->SetTelCallState(TelCallState::CALL_STATUS_HOLDING);
+        } else {
+            call->SetTelCallState(TelCallState::CALL_STATUS_ACTIVE);
+        }
+        g_callList.emplace_back(call);
+    }
+}
+
+void TearDownRegistryCalls()
+{
+    for (auto &call : g_callList) {
+        CallObjectManager::DeleteOneCallObject(call);
+    }
+    g_callList.clear();
+}
+
+template<typename Function>
+static void RunRegistryQuery(benchmark::State &state, Function function)
+{
+    if (state.thread_index() == 0) {
+        // the ringing call is the first one added, the lookups for the last call have to pass all others
+        SetUpRegistryCalls(state.range(0), TelCallState::CALL_STATUS_INCOMING);
+    }
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        recorder.Measure(function);
+    }
+    recorder.Report(state);
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        TearDownRegistryCalls();
+    }
+}
+
+static void BM_GetOneCallObjectById(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(CallObjectManager::GetOneCallObject(g_callList.back()->GetCallID()));
+    });
+}
+
+static void BM_GetOneCallObjectByNumber(benchmark::State &state)
+{
+    std::string number = GetCallNumber(static_cast<int32_t>(state.range(0)) - 1);
+    RunRegistryQuery(state, [&number]() { benchmark::DoNotOptimize(CallObjectManager::GetOneCallObject(number)); });
+}
+
+static void BM_GetOneCallObjectByRunningState(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(CallObjectManager::GetOneCallObject(CallRunningState::CALL_RUNNING_STATE_RINGING));
+    });
+}
+
+static void BM_IsCallExistByState(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        int32_t callId = ERR_ID;
+        benchmark::DoNotOptimize(CallObjectManager::IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId));
+    });
+}
+
+static void BM_GetCallState(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(CallObjectManager::GetCallState(g_callList.back()->GetCallID()));
+    });
+}
+
+static void BM_GetCallInfoList(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() { benchmark::DoNotOptimize(CallObjectManager::GetCallInfoList(0)); });
+}
+
+static void BM_GetCarrierCallList(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        std::list<int32_t> callIdList;
+        benchmark::DoNotOptimize(CallObjectManager::GetCarrierCallList(callIdList));
+    });
+}
+
+static void BM_HasEmergencyCall(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() { benchmark::DoNotOptimize(CallObjectManager::HasEmergencyCall()); });
+}
+
+static void BM_AnswerCallPolicy(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(GetCallPolicy().AnswerCallPolicy(
+            g_callList.front()->GetCallID(), static_cast<int32_t>(VideoStateType::TYPE_VOICE)));
+    });
+}
+
+static void BM_HoldCallPolicy(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(GetCallPolicy().HoldCallPolicy(g_callList.back()->GetCallID()));
+    });
+}
+
+static void BM_HangUpPolicy(benchmark::State &state)
+{
+    RunRegistryQuery(state, []() {
+        benchmark::DoNotOptimize(GetCallPolicy().HangUpPolicy(g_callList.back()->GetCallID()));
+    });
+}
+
+static void RegistryArguments(benchmark::internal::Benchmark *benchmark)
+{
+    for (int64_t callNum : BENCHMARK_CALL_NUM_LIST) {
+        benchmark->Arg(callNum);
+    }
+    benchmark->ArgName("calls")->ThreadRange(1, BENCHMARK_MAX_THREAD_NUM)->UseRealTime();
+}
+
+BENCHMARK(BM_GetOneCallObjectById)->Apply(RegistryArguments);
+BENCHMARK(BM_GetOneCallObjectByNumber)->Apply(RegistryArguments);
+BENCHMARK(BM_GetOneCallObjectByRunningState)->Apply(RegistryArguments);
+BENCHMARK(BM_IsCallExistByState)->Apply(RegistryArguments);
+BENCHMARK(BM_GetCallState)->Apply(RegistryArguments);
+BENCHMARK(BM_GetCallInfoList)->Apply(RegistryArguments);
+BENCHMARK(BM_GetCarrierCallList)->Apply(RegistryArguments);
+BENCHMARK(BM_HasEmergencyCall)->Apply(RegistryArguments);
+BENCHMARK(BM_AnswerCallPolicy)->Apply(RegistryArguments);
+BENCHMARK(BM_HoldCallPolicy)->Apply(RegistryArguments);
+BENCHMARK(BM_HangUpPolicy)->Apply(RegistryArguments);
+} // namespace Telephony
+} // namespace OHOS
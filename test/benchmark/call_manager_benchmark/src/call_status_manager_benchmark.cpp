@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "securec.h"
+
+#include "call_manager_benchmark.h"
+#include "call_status_manager.h"
+#include "cs_call.h"
+#include "ims_call.h"
+
+namespace {
+std::atomic<uint64_t> g_heapAllocCount(0);
+} // namespace
+
+void *operator new(size_t size)
+{
+    ++g_heapAllocCount;
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace Telephony {
+uint64_t GetHeapAllocCount()
+{
+    return g_heapAllocCount.load();
+}
+
+const char *BENCHMARK_PHONE_NUMBER = "10086";
+
+constexpr int32_t LIFECYCLE_CALL_INDEX = CALL_ID_SPACE_SIZE;
+
+static void BuildCallDetailInfo(CallDetailInfo &info, CallType callType, TelCallState state)
+{
+    (void)memset_s(&info, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
+    (void)strcpy_s(info.phoneNum, kMaxNumberLen, BENCHMARK_PHONE_NUMBER);
+    info.index = LIFECYCLE_CALL_INDEX;
+    info.accountId = 0;
+    info.callType = callType;
+    info.callMode = VideoStateType::TYPE_VOICE;
+    info.state = state;
+    info.voiceDomain = (callType == CallType::TYPE_IMS) ? 1 : 0;
+}
+
+/**
+ * allocations done by one incoming call, from IncomingHandle through NotifyNewCallCreated and the first
+ * state update; the call is disconnected again outside of the measured region
+ */
+static void IncomingCallSetup(benchmark::State &state, CallType callType)
+{
+    CallStatusManager statusManager;
+    statusManager.Init();
+    CallDetailInfo incomingInfo;
+    BuildCallDetailInfo(incomingInfo, callType, TelCallState::CALL_STATUS_INCOMING);
+    CallDetailInfo disconnectedInfo;
+    BuildCallDetailInfo(disconnectedInfo, callType, TelCallState::CALL_STATUS_DISCONNECTED);
+    uint64_t allocCount = 0;
+    for (auto _ : state) {
+        uint64_t before = GetHeapAllocCount();
+        benchmark::DoNotOptimize(statusManager.HandleCallReportInfo(incomingInfo));
+        allocCount += GetHeapAllocCount() - before;
+        state.PauseTiming();
+        (void)statusManager.HandleCallReportInfo(disconnectedInfo);
+        state.ResumeTiming();
+    }
+    CallObjectPoolStatistics poolStatistics = (callType == CallType::TYPE_IMS) ?
+        IMSCall::GetPoolStatistics() : CSCall::GetPoolStatistics();
+    state.counters["heap_allocs_per_call"] =
+        benchmark::Counter(static_cast<double>(allocCount), benchmark::Counter::kAvgIterations);
+    state.counters["pool_allocs"] = static_cast<double>(poolStatistics.poolAllocCount);
+    state.counters["pool_heap_fallbacks"] = static_cast<double>(poolStatistics.heapAllocCount);
+}
+
+static void BM_IncomingCsCallSetup(benchmark::State &state)
+{
+    IncomingCallSetup(state, CallType::TYPE_CS);
+}
+
+static void BM_IncomingImsCallSetup(benchmark::State &state)
+{
+    IncomingCallSetup(state, CallType::TYPE_IMS);
+}
+
+/**
+ * one incoming call reported through the whole HandleCallReportInfo path, from incoming over active to
+ * disconnected, while state.range(0) other calls are already in the registry
+ */
+static void BM_IncomingCallLifecycle(benchmark::State &state)
+{
+    CallStatusManager statusManager;
+    statusManager.Init();
+    SetUpRegistryCalls(state.range(0), TelCallState::CALL_STATUS_ACTIVE);
+    CallDetailInfo incomingInfo;
+    BuildCallDetailInfo(incomingInfo, CallType::TYPE_CS, TelCallState::CALL_STATUS_INCOMING);
+    CallDetailInfo activeInfo;
+    BuildCallDetailInfo(activeInfo, CallType::TYPE_CS, TelCallState::CALL_STATUS_ACTIVE);
+    CallDetailInfo disconnectedInfo;
+    BuildCallDetailInfo(disconnectedInfo, CallType::TYPE_CS, TelCallState::CALL_STATUS_DISCONNECTED);
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        recorder.Measure([&]() {
+            benchmark::DoNotOptimize(statusManager.HandleCallReportInfo(incomingInfo));
+            benchmark::DoNotOptimize(statusManager.HandleCallReportInfo(activeInfo));
+            benchmark::DoNotOptimize(statusManager.HandleCallReportInfo(disconnectedInfo));
+        });
+    }
+    recorder.Report(state);
+    state.SetItemsProcessed(state.iterations());
+    TearDownRegistryCalls();
+}
+
+static void LifecycleArguments(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->Arg(0);
+    for (int64_t callNum : BENCHMARK_CALL_NUM_LIST) {
+        // one call id is left for the reported call
+        benchmark->Arg(std::min<int64_t>(callNum, CALL_ID_SPACE_SIZE - 2));
+    }
+    benchmark->ArgName("calls");
+}
+
+BENCHMARK(BM_IncomingCsCallSetup);
+BENCHMARK(BM_IncomingImsCallSetup);
+BENCHMARK(BM_IncomingCallLifecycle)->Apply(LifecycleArguments);
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "iremote_stub.h"
+#include "securec.h"
+
+#include "call_manager_benchmark.h"
+#include "call_manager_errors.h"
+#include "cellular_call_connection.h"
+#include "cellular_call_proxy.h"
+
+namespace OHOS {
+namespace Telephony {
+// time the stub service takes for every request, in the range of a binder round trip to the cellular call service
+constexpr int64_t STUB_CELLULAR_CALL_SERVICE_TIME_US = 200;
+
+enum CellularCallLoadRole {
+    CELLULAR_CALL_LOAD_HANG_UP_SLOT_0 = 0,
+    CELLULAR_CALL_LOAD_HOLD_CALL_SLOT_1,
+    CELLULAR_CALL_LOAD_GET_CALL_WAITING_SLOT_1,
+    CELLULAR_CALL_LOAD_ROLE_NUM,
+};
+
+/**
+ * @ClassName:StubCellularCallService
+ * @Description:in-process cellular call service answering every request with TELEPHONY_SUCCESS
+ * after STUB_CELLULAR_CALL_SERVICE_TIME_US, so concurrent requests overlap like they would on the service.
+ */
+class StubCellularCallService : public IPCObjectStub {
+public:
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(STUB_CELLULAR_CALL_SERVICE_TIME_US));
+        reply.WriteInt32(TELEPHONY_SUCCESS);
+        return ERR_NONE;
+    }
+};
+
+static bool SetUpStubCellularCallService()
+{
+    sptr<StubCellularCallService> service = new StubCellularCallService();
+    sptr<CellularCallProxy> proxy = new CellularCallProxy(service);
+    DelayedSingleton<CellularCallConnection>::GetInstance()->SetCellularCallInterface(proxy.GetRefPtr());
+    return true;
+}
+
+static int32_t SendLoadRequest(int32_t role, CellularCallInfo &callInfo)
+{
+    std::shared_ptr<CellularCallConnection> connection = DelayedSingleton<CellularCallConnection>::GetInstance();
+    switch (role) {
+        case CELLULAR_CALL_LOAD_HANG_UP_SLOT_0:
+            callInfo.slotId = SIM_SLOT_0;
+            return connection->HangUp(callInfo, CallSupplementType::TYPE_DEFAULT);
+        case CELLULAR_CALL_LOAD_HOLD_CALL_SLOT_1:
+            callInfo.slotId = SIM_SLOT_1;
+            return connection->HoldCall(callInfo);
+        default:
+            return connection->GetCallWaiting(SIM_SLOT_1);
+    }
+}
+
+/**
+ * mixed load on CellularCallConnection against the stub service: the threads take turns at hanging up on slot 0,
+ * holding on slot 1 and querying call waiting on slot 1. isGlobalLock sends every request under one lock,
+ * the way all requests were serialized before the per-slot ordering, and is the baseline of the load benchmark.
+ */
+static void RunCellularCallMixedLoad(benchmark::State &state, bool isGlobalLock)
+{
+    static bool isStubServiceSet = SetUpStubCellularCallService();
+    static std::mutex globalLock;
+    benchmark::DoNotOptimize(isStubServiceSet);
+    int32_t role = state.thread_index() % CELLULAR_CALL_LOAD_ROLE_NUM;
+    CellularCallInfo callInfo;
+    (void)memset_s(&callInfo, sizeof(CellularCallInfo), 0, sizeof(CellularCallInfo));
+    (void)strcpy_s(callInfo.phoneNum, kMaxNumberLen, "10086");
+    callInfo.callId = role + 1;
+    LatencyRecorder recorder;
+    for (auto _ : state) {
+        recorder.Measure([&]() {
+            if (isGlobalLock) {
+                std::lock_guard<std::mutex> lock(globalLock);
+                benchmark::DoNotOptimize(SendLoadRequest(role, callInfo));
+            } else {
+                benchmark::DoNotOptimize(SendLoadRequest(role, callInfo));
+            }
+        });
+    }
+    recorder.Report(state);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_CellularCallConnectionMixedLoad(benchmark::State &state)
+{
+    RunCellularCallMixedLoad(state, false);
+}
+
+static void BM_CellularCallGlobalLockMixedLoad(benchmark::State &state)
+{
+    RunCellularCallMixedLoad(state, true);
+}
+
+BENCHMARK(BM_CellularCallGlobalLockMixedLoad)->ThreadRange(1, BENCHMARK_MAX_THREAD_NUM)->UseRealTime();
+BENCHMARK(BM_CellularCallConnectionMixedLoad)->ThreadRange(1, BENCHMARK_MAX_THREAD_NUM)->UseRealTime();
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include "iremote_stub.h"
+#include "securec.h"
+
+#include "call_manager_benchmark.h"
+#include "call_manager_errors.h"
+#include "cellular_call_proxy.h"
+
+namespace OHOS {
+namespace Telephony {
+// value CellularCallProxy writes in front of the arguments of every request
+constexpr int32_t CELLULAR_CALL_MAX_SIZE = 10;
+constexpr char BENCHMARK_DTMF_CODE = '1';
+
+enum CellularCallRequest {
+    CELLULAR_CALL_REQUEST_DIAL = 0,
+    CELLULAR_CALL_REQUEST_HANG_UP,
+    CELLULAR_CALL_REQUEST_START_DTMF,
+};
+
+/**
+ * @ClassName:LoopbackCellularCallStub
+ * @Description:in-process cellular call stub answering every request with TELEPHONY_SUCCESS,
+ * so the benchmarks measure the proxy side only.
+ */
+class LoopbackCellularCallStub : public IPCObjectStub {
+public:
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        reply.WriteInt32(TELEPHONY_SUCCESS);
+        return ERR_NONE;
+    }
+};
+
+static void BuildCellularCallInfo(CellularCallInfo &callInfo)
+{
+    (void)memset_s(&callInfo, sizeof(CellularCallInfo), 0, sizeof(CellularCallInfo));
+    (void)strcpy_s(callInfo.phoneNum, kMaxNumberLen, "10086");
+    callInfo.callId = 1;
+    callInfo.slotId = 0;
+}
+
+static int32_t SendProxyRequest(CellularCallProxy &proxy, int64_t request, const CellularCallInfo &callInfo)
+{
+    switch (request) {
+        case CELLULAR_CALL_REQUEST_DIAL:
+            return proxy.Dial(callInfo);
+        case CELLULAR_CALL_REQUEST_HANG_UP:
+            return proxy.HangUp(callInfo, CallSupplementType::TYPE_DEFAULT);
+        default:
+            return proxy.StartDtmf(BENCHMARK_DTMF_CODE, callInfo);
+    }
+}
+
+/**
+ * the marshaling every CellularCallProxy request did before the request parcel was reused:
+ * fresh parcels and one hand written Write call per argument. Kept as the baseline of the proxy benchmarks.
+ */
+static int32_t SendFreshParcelRequest(IRemoteObject &remote, int64_t request, const CellularCallInfo &callInfo)
+{
+    MessageOption option;
+    MessageParcel in;
+    MessageParcel out;
+    if (!in.WriteInterfaceToken(CellularCallProxy::GetDescriptor())) {
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!in.WriteInt32(CELLULAR_CALL_MAX_SIZE)) {
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    CellularCallInterface::OperationType type = CellularCallInterface::OperationType::DIAL;
+    if (request == CELLULAR_CALL_REQUEST_START_DTMF) {
+        const char dtmfCode[] = { BENCHMARK_DTMF_CODE, '\0' };
+        if (!in.WriteCString(dtmfCode)) {
+            return TELEPHONY_ERR_WRITE_DATA_FAIL;
+        }
+        type = CellularCallInterface::OperationType::START_DTMF;
+    }
+    if (!in.WriteRawData((const void *)&callInfo, sizeof(CellularCallInfo))) {
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    if (request == CELLULAR_CALL_REQUEST_HANG_UP) {
+        if (!in.WriteInt32((int32_t)CallSupplementType::TYPE_DEFAULT)) {
+            return TELEPHONY_ERR_WRITE_DATA_FAIL;
+        }
+        type = CellularCallInterface::OperationType::HANG_UP;
+    }
+    int32_t error = remote.SendRequest(static_cast<uint32_t>(type), in, out, option);
+    if (error == ERR_NONE) {
+        return out.ReadInt32();
+    }
+    return error;
+}
+
+/**
+ * time and heap allocations of one downlink request through CellularCallProxy against a loopback stub,
+ * isFreshParcel runs the pre-reuse marshaling instead
+ */
+static void MeasureCellularCallRequest(benchmark::State &state, CellularCallRequest request, bool isFreshParcel)
+{
+    sptr<LoopbackCellularCallStub> stub = new LoopbackCellularCallStub();
+    CellularCallProxy proxy(stub);
+    CellularCallInfo callInfo;
+    BuildCellularCallInfo(callInfo);
+    // the first request of the thread creates the reused parcel, it is not part of the steady state
+    (void)SendProxyRequest(proxy, request, callInfo);
+    uint64_t allocCount = 0;
+    for (auto _ : state) {
+        uint64_t before = GetHeapAllocCount();
+        if (isFreshParcel) {
+            benchmark::DoNotOptimize(SendFreshParcelRequest(*stub, request, callInfo));
+        } else {
+            benchmark::DoNotOptimize(SendProxyRequest(proxy, request, callInfo));
+        }
+        allocCount += GetHeapAllocCount() - before;
+    }
+    state.counters["heap_allocs_per_request"] =
+        benchmark::Counter(static_cast<double>(allocCount), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_CellularCallProxyRequest(benchmark::State &state, CellularCallRequest request)
+{
+    MeasureCellularCallRequest(state, request, false);
+}
+
+static void BM_CellularCallFreshParcelRequest(benchmark::State &state, CellularCallRequest request)
+{
+    MeasureCellularCallRequest(state, request, true);
+}
+
+BENCHMARK_CAPTURE(BM_CellularCallFreshParcelRequest, Dial, CELLULAR_CALL_REQUEST_DIAL);
+BENCHMARK_CAPTURE(BM_CellularCallProxyRequest, Dial, CELLULAR_CALL_REQUEST_DIAL);
+BENCHMARK_CAPTURE(BM_CellularCallFreshParcelRequest, HangUp, CELLULAR_CALL_REQUEST_HANG_UP);
+BENCHMARK_CAPTURE(BM_CellularCallProxyRequest, HangUp, CELLULAR_CALL_REQUEST_HANG_UP);
+BENCHMARK_CAPTURE(BM_CellularCallFreshParcelRequest, StartDtmf, CELLULAR_CALL_REQUEST_START_DTMF);
+BENCHMARK_CAPTURE(BM_CellularCallProxyRequest, StartDtmf, CELLULAR_CALL_REQUEST_START_DTMF);
+} // namespace Telephony
+} // namespace OHOS
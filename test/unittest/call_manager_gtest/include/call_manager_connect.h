@@ -320,6 +320,42 @@ public:
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
 
+    int32_t AnswerAndHoldActiveCall(int32_t callId, int32_t videoState) const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->AnswerAndHoldActiveCall(callId, videoState);
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
+    int32_t AnswerAndEndActiveCall(int32_t callId, int32_t videoState) const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->AnswerAndEndActiveCall(callId, videoState);
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
+    int32_t HangUpAllCall() const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->HangUpAllCall();
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
+    int32_t HangUpAllCallOnSlot(int32_t slotId) const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->HangUpAllCallOnSlot(slotId);
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
     int32_t GetCallState() const
     {
         if (callManagerServicePtr_ != nullptr) {
@@ -392,6 +428,24 @@ public:
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
 
+    int32_t SendDtmfString(int32_t callId, std::u16string &dtmfString, int32_t onLength, int32_t offLength) const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->SendDtmfString(callId, dtmfString, onLength, offLength);
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
+    int32_t GetCallSnapshot(std::vector<CallSnapshotInfo> &callList) const
+    {
+        if (callManagerServicePtr_ != nullptr) {
+            return callManagerServicePtr_->GetCallSnapshot(callList);
+        }
+        TELEPHONY_LOGE("callManagerServicePtr_ is nullptr!");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+
     int32_t GetCallWaiting(int32_t slotId) const
     {
         if (callManagerServicePtr_ != nullptr) {
@@ -85,6 +85,17 @@ public:
         dialInfo_.PutIntValue("dialType", dialType);
     }
 
+    // the id of the first call of the service, the dialed one when a test makes a single call
+    bool GetFirstCallId(int32_t &callId)
+    {
+        std::vector<CallSnapshotInfo> callList;
+        if (clientPtr_->GetCallSnapshot(callList) != TELEPHONY_SUCCESS || callList.empty()) {
+            return false;
+        }
+        callId = callList.front().info.callId;
+        return true;
+    }
+
     // execute before each testcase
     void SetUp()
     {
@@ -17,7 +17,9 @@
 
 #include <cstring>
 #include <gtest/gtest.h>
+#include <securec.h>
 #include <string>
+#include <vector>
 
 namespace OHOS {
 namespace Telephony {
@@ -293,6 +295,152 @@ HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpCall_0200, Function | Med
     EXPECT_NE(CallManagerGtest::clientPtr_->HangUpCall(callId), RETURN_VALUE_IS_ZERO);
 }
 
+/*************************************** Test AnswerAndHoldActiveCall() ******************************************/
+/**
+ * @tc.number   Telephony_CallManager_AnswerAndHoldActiveCall_0100
+ * @tc.name     test AnswerAndHoldActiveCall with the callId does not exist, return non 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_AnswerAndHoldActiveCall_0100, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    int32_t callId = INVALID_NEGATIVE_ID;
+    int32_t videoState = (int32_t)VideoStateType::TYPE_VOICE;
+    EXPECT_NE(CallManagerGtest::clientPtr_->AnswerAndHoldActiveCall(callId, videoState), RETURN_VALUE_IS_ZERO);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_AnswerAndHoldActiveCall_0200
+ * @tc.name     test AnswerAndHoldActiveCall with the callId and the videoState do not exist, return non 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_AnswerAndHoldActiveCall_0200, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    int32_t callId = INVALID_POSITIVE_ID;
+    int32_t videoState = INVALID_NEGATIVE_ID;
+    EXPECT_NE(CallManagerGtest::clientPtr_->AnswerAndHoldActiveCall(callId, videoState), RETURN_VALUE_IS_ZERO);
+}
+
+/*************************************** Test AnswerAndEndActiveCall() ******************************************/
+/**
+ * @tc.number   Telephony_CallManager_AnswerAndEndActiveCall_0100
+ * @tc.name     test AnswerAndEndActiveCall with the callId does not exist, return non 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_AnswerAndEndActiveCall_0100, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    int32_t callId = INVALID_NEGATIVE_ID;
+    int32_t videoState = (int32_t)VideoStateType::TYPE_VOICE;
+    EXPECT_NE(CallManagerGtest::clientPtr_->AnswerAndEndActiveCall(callId, videoState), RETURN_VALUE_IS_ZERO);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_AnswerAndEndActiveCall_0200
+ * @tc.name     test AnswerAndEndActiveCall with the callId and the videoState do not exist, return non 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_AnswerAndEndActiveCall_0200, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    int32_t callId = INVALID_POSITIVE_ID;
+    int32_t videoState = INVALID_NEGATIVE_ID;
+    EXPECT_NE(CallManagerGtest::clientPtr_->AnswerAndEndActiveCall(callId, videoState), RETURN_VALUE_IS_ZERO);
+}
+
+/******************************************* Test HangUpAllCall() *********************************************/
+/**
+ * @tc.number   Telephony_CallManager_HangUpAllCall_0100
+ * @tc.name     in CALL_STATE_IDLE status, test HangUpAllCall(), return CALL_ERR_PHONE_CALLS_TOO_FEW
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpAllCall_0100, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), CALL_ERR_PHONE_CALLS_TOO_FEW);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_HangUpAllCall_0200
+ * @tc.name     test HangUpAllCall() after DialCall, return 0 and the call state goes back to idle
+ *              wait for the correct status of the callback to execute correctly
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpAllCall_0200, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::string phoneNumber = "00000000000";
+    InitDialInfo(0, (int32_t)VideoStateType::TYPE_VOICE, (int32_t)DialScene::CALL_NORMAL,
+        (int32_t)DialType::DIAL_CARRIER_TYPE);
+    if (CallManagerGtest::clientPtr_->DialCall(Str8ToStr16(phoneNumber), dialInfo_) != RETURN_VALUE_IS_ZERO) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), RETURN_VALUE_IS_ZERO);
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+}
+
+/**************************************** Test HangUpAllCallOnSlot() ******************************************/
+/**
+ * @tc.number   Telephony_CallManager_HangUpAllCallOnSlot_0100
+ * @tc.name     input invalid slotId -100, test HangUpAllCallOnSlot(), return CALL_ERR_INVALID_SLOT_ID
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpAllCallOnSlot_0100, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCallOnSlot(INVALID_NEGATIVE_ID), CALL_ERR_INVALID_SLOT_ID);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_HangUpAllCallOnSlot_0200
+ * @tc.name     input invalid slotId 100, test HangUpAllCallOnSlot(), return CALL_ERR_INVALID_SLOT_ID
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpAllCallOnSlot_0200, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCallOnSlot(INVALID_POSITIVE_ID), CALL_ERR_INVALID_SLOT_ID);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_HangUpAllCallOnSlot_0300
+ * @tc.name     in CALL_STATE_IDLE status, input slotId 0, test HangUpAllCallOnSlot(),
+ *              return CALL_ERR_PHONE_CALLS_TOO_FEW
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_HangUpAllCallOnSlot_0300, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCallOnSlot(SIM1_SLOTID), CALL_ERR_PHONE_CALLS_TOO_FEW);
+}
+
 /******************************************* Test GetCallState() *********************************************/
 /**
  * @tc.number   Telephony_CallManager_GetCallState_0100
@@ -695,6 +843,165 @@ HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallIdListForConference_0200
         ans.clear();
     }
 }
+/******************************************* Test GetCallSnapshot() *********************************************/
+// answers GetCallSnapshot in place of the service, so both transports and malformed replies are tested without a call
+class CallSnapshotReplyStub : public IPCObjectStub {
+public:
+    CallSnapshotReplyStub(uint32_t version, uint32_t entryNum, int32_t transport)
+        : IPCObjectStub(u"CallSnapshotReplyStub"), version_(version), entryNum_(entryNum), transport_(transport)
+    {}
+
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        std::vector<CallSnapshotInfo> callList(entryNum_);
+        for (uint32_t i = 0; i < entryNum_; ++i) {
+            (void)memset_s(&callList[i], sizeof(CallSnapshotInfo), 0, sizeof(CallSnapshotInfo));
+            callList[i].info.callId = static_cast<int32_t>(i) + 1;
+            callList[i].mainCallId = static_cast<int32_t>(i) + 1;
+        }
+        int32_t length = static_cast<int32_t>(sizeof(CallSnapshotInfo) * entryNum_);
+        reply.WriteInt32(TELEPHONY_SUCCESS);
+        reply.WriteUint32(version_);
+        reply.WriteUint32(sizeof(CallSnapshotInfo));
+        reply.WriteUint32(entryNum_);
+        reply.WriteInt32(transport_);
+        if (transport_ != CALL_SNAPSHOT_TRANSPORT_ASHMEM) {
+            reply.WriteInt32(length);
+            if (length > 0) {
+                reply.WriteRawData(callList.data(), length);
+            }
+            return TELEPHONY_SUCCESS;
+        }
+        sptr<Ashmem> ashmem = Ashmem::CreateAshmem("CallSnapshotTest", length);
+        if (ashmem == nullptr) {
+            return TELEPHONY_ERR_LOCAL_PTR_NULL;
+        }
+        if (ashmem->MapReadAndWriteAshmem() && ashmem->WriteToAshmem(callList.data(), length, 0)) {
+            reply.WriteAshmem(ashmem);
+        }
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        return TELEPHONY_SUCCESS;
+    }
+
+private:
+    uint32_t version_;
+    uint32_t entryNum_;
+    int32_t transport_;
+};
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0100
+ * @tc.name     in CALL_STATE_IDLE status, test GetCallSnapshot(), return 0 and an empty list
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0100, Function | MediumTest | Level1)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(CallManagerGtest::clientPtr_->GetCallSnapshot(callList), RETURN_VALUE_IS_ZERO);
+    EXPECT_TRUE(callList.empty());
+}
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0200
+ * @tc.name     after DialCall, test GetCallSnapshot(), return 0 and the dialed call,
+ *              not in a conference, is its own main call
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0200, Function | MediumTest | Level1)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::string phoneNumber = "00000000000";
+    InitDialInfo(0, (int32_t)VideoStateType::TYPE_VOICE, (int32_t)DialScene::CALL_NORMAL,
+        (int32_t)DialType::DIAL_CARRIER_TYPE);
+    if (CallManagerGtest::clientPtr_->DialCall(Str8ToStr16(phoneNumber), dialInfo_) != RETURN_VALUE_IS_ZERO) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(CallManagerGtest::clientPtr_->GetCallSnapshot(callList), RETURN_VALUE_IS_ZERO);
+    ASSERT_EQ(callList.size(), 1u);
+    EXPECT_EQ(callList[0].mainCallId, callList[0].info.callId);
+    EXPECT_EQ(callList[0].info.callType, CallType::TYPE_CS);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), RETURN_VALUE_IS_ZERO);
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0300
+ * @tc.name     reply the entries in the parcel, test GetCallSnapshot(), return 0 and all the entries
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0300, Function | MediumTest | Level1)
+{
+    uint32_t entryNum = 2;
+    sptr<IRemoteObject> remote = new CallSnapshotReplyStub(CALL_SNAPSHOT_VERSION, entryNum,
+        CALL_SNAPSHOT_TRANSPORT_PARCEL);
+    sptr<CallManagerServiceProxy> proxy = new CallManagerServiceProxy(remote);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(proxy->GetCallSnapshot(callList), RETURN_VALUE_IS_ZERO);
+    ASSERT_EQ(callList.size(), entryNum);
+    EXPECT_EQ(callList[0].info.callId, 1);
+    EXPECT_EQ(callList[1].mainCallId, 2);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0400
+ * @tc.name     reply more than CALL_SNAPSHOT_ASHMEM_THRESHOLD bytes of entries in ashmem,
+ *              test GetCallSnapshot(), return 0 and all the entries
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0400, Function | MediumTest | Level1)
+{
+    uint32_t entryNum = CALL_SNAPSHOT_ASHMEM_THRESHOLD / sizeof(CallSnapshotInfo) + 1;
+    sptr<IRemoteObject> remote = new CallSnapshotReplyStub(CALL_SNAPSHOT_VERSION, entryNum,
+        CALL_SNAPSHOT_TRANSPORT_ASHMEM);
+    sptr<CallManagerServiceProxy> proxy = new CallManagerServiceProxy(remote);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(proxy->GetCallSnapshot(callList), RETURN_VALUE_IS_ZERO);
+    ASSERT_EQ(callList.size(), entryNum);
+    EXPECT_EQ(callList[0].info.callId, 1);
+    EXPECT_EQ(callList[entryNum - 1].info.callId, static_cast<int32_t>(entryNum));
+}
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0500
+ * @tc.name     reply an unknown transport, test GetCallSnapshot(), return TELEPHONY_ERR_READ_DATA_FAIL
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0500, Function | MediumTest | Level2)
+{
+    sptr<IRemoteObject> remote = new CallSnapshotReplyStub(CALL_SNAPSHOT_VERSION, 1,
+        CALL_SNAPSHOT_TRANSPORT_ASHMEM + 1);
+    sptr<CallManagerServiceProxy> proxy = new CallManagerServiceProxy(remote);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(proxy->GetCallSnapshot(callList), TELEPHONY_ERR_READ_DATA_FAIL);
+    EXPECT_TRUE(callList.empty());
+}
+
+/**
+ * @tc.number   Telephony_CallManager_GetCallSnapshot_0600
+ * @tc.name     reply a version older than CALL_SNAPSHOT_VERSION, test GetCallSnapshot(),
+ *              return TELEPHONY_ERR_READ_DATA_FAIL
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_GetCallSnapshot_0600, Function | MediumTest | Level2)
+{
+    sptr<IRemoteObject> remote = new CallSnapshotReplyStub(CALL_SNAPSHOT_VERSION - 1, 1,
+        CALL_SNAPSHOT_TRANSPORT_PARCEL);
+    sptr<CallManagerServiceProxy> proxy = new CallManagerServiceProxy(remote);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(proxy->GetCallSnapshot(callList), TELEPHONY_ERR_READ_DATA_FAIL);
+    EXPECT_TRUE(callList.empty());
+}
+
 /************************************* Test IsEmergencyPhoneNumber() ***************************************/
 /**
  * @tc.number   Telephony_CallManager_IsEmergencyPhoneNumber_0100
@@ -893,6 +1200,140 @@ HWTEST_F(CallManagerGtest, Telephony_CallManager_StopDtmf_0200, Function | Mediu
     EXPECT_NE(CallManagerGtest::clientPtr_->StopDtmf(callId), RETURN_VALUE_IS_ZERO);
 }
 
+/********************************************* Test SendDtmfString() ***********************************************/
+/**
+ * @tc.number   Telephony_CallManager_SendDtmfString_0100
+ * @tc.name     Import callId -100, test SendDtmfString(), return non 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_SendDtmfString_0100, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    int32_t callId = INVALID_NEGATIVE_ID;
+    std::u16string dtmfString = u"123";
+    EXPECT_NE(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0), RETURN_VALUE_IS_ZERO);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_SendDtmfString_0200
+ * @tc.name     Import a string longer than DTMF_STRING_MAX_LEN, test SendDtmfString(),
+ *              return CALL_ERR_DTMF_EXCEED_LIMIT
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_SendDtmfString_0200, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    int32_t callId = INVALID_POSITIVE_ID;
+    std::u16string dtmfString(DTMF_STRING_MAX_LEN + 1, u'1');
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0), CALL_ERR_DTMF_EXCEED_LIMIT);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_SendDtmfString_0300
+ * @tc.name     after DialCall, import tone and gap lengths out of [DTMF_MIN_LENGTH, DTMF_MAX_LENGTH],
+ *              test SendDtmfString(), return TELEPHONY_ERR_ARGUMENT_INVALID
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_SendDtmfString_0300, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::string phoneNumber = "00000000000";
+    InitDialInfo(0, (int32_t)VideoStateType::TYPE_VOICE, (int32_t)DialScene::CALL_NORMAL,
+        (int32_t)DialType::DIAL_CARRIER_TYPE);
+    int32_t callId = INVALID_NEGATIVE_ID;
+    if (CallManagerGtest::clientPtr_->DialCall(Str8ToStr16(phoneNumber), dialInfo_) != RETURN_VALUE_IS_ZERO) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    if (!GetFirstCallId(callId)) {
+        return;
+    }
+    std::u16string dtmfString = u"123";
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, DTMF_MIN_LENGTH - 1, 0),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, DTMF_MAX_LENGTH + 1, 0),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, DTMF_MIN_LENGTH - 1),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, INVALID_NEGATIVE_ID),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), RETURN_VALUE_IS_ZERO);
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_SendDtmfString_0400
+ * @tc.name     after DialCall, import invalid characters, and an empty string while no string waits,
+ *              test SendDtmfString(), return TELEPHONY_ERR_ARGUMENT_INVALID
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_SendDtmfString_0400, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::string phoneNumber = "00000000000";
+    InitDialInfo(0, (int32_t)VideoStateType::TYPE_VOICE, (int32_t)DialScene::CALL_NORMAL,
+        (int32_t)DialType::DIAL_CARRIER_TYPE);
+    int32_t callId = INVALID_NEGATIVE_ID;
+    if (CallManagerGtest::clientPtr_->DialCall(Str8ToStr16(phoneNumber), dialInfo_) != RETURN_VALUE_IS_ZERO) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    if (!GetFirstCallId(callId)) {
+        return;
+    }
+    std::u16string dtmfString = u"12x";
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    dtmfString = u"";
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0),
+        TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), RETURN_VALUE_IS_ZERO);
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+}
+
+/**
+ * @tc.number   Telephony_CallManager_SendDtmfString_0500
+ * @tc.name     after DialCall, import a string with a pause and a wait character, test SendDtmfString(),
+ *              then continue after the wait with an empty string, return 0
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallManager_SendDtmfString_0500, Function | MediumTest | Level2)
+{
+    if (!HasSimCard()) {
+        return;
+    }
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    std::string phoneNumber = "00000000000";
+    InitDialInfo(0, (int32_t)VideoStateType::TYPE_VOICE, (int32_t)DialScene::CALL_NORMAL,
+        (int32_t)DialType::DIAL_CARRIER_TYPE);
+    int32_t callId = INVALID_NEGATIVE_ID;
+    if (CallManagerGtest::clientPtr_->DialCall(Str8ToStr16(phoneNumber), dialInfo_) != RETURN_VALUE_IS_ZERO) {
+        return;
+    }
+    CallInfoManager::LockCallState(false, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+    if (!GetFirstCallId(callId)) {
+        return;
+    }
+    std::u16string dtmfString = u"1,2;3";
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0), RETURN_VALUE_IS_ZERO);
+    // the digit behind the pause is sent DTMF_PAUSE_LENGTH later, then the string waits before 3
+    usleep((DTMF_PAUSE_LENGTH + DTMF_MAX_LENGTH) * SLEEP_1000_MS);
+    dtmfString = u"";
+    EXPECT_EQ(CallManagerGtest::clientPtr_->SendDtmfString(callId, dtmfString, 0, 0), RETURN_VALUE_IS_ZERO);
+    EXPECT_EQ(CallManagerGtest::clientPtr_->HangUpAllCall(), RETURN_VALUE_IS_ZERO);
+    CallInfoManager::LockCallState(true, (int32_t)CallStateToApp::CALL_STATE_IDLE, SLEEP_200_MS, SLEEP_30000_MS);
+}
+
 /******************************** Test FormatPhoneNumber() * **************************************/
 
 /**
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include "call_id_allocator.h"
+#include "call_manager_inner_type.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t CALL_ID_NUM = CALL_ID_SPACE_SIZE - CALL_START_ID - 1;
+
+class CallIdAllocatorGtest : public testing::Test {
+public:
+    // hands out every id, so the next Allocate() can only return an id released afterwards
+    void AllocateAll(CallIdAllocator &allocator)
+    {
+        for (int32_t i = 0; i < CALL_ID_NUM; ++i) {
+            allocator.Allocate();
+        }
+    }
+};
+
+/********************************************* Test Allocate() ***********************************************/
+/**
+ * @tc.number   Telephony_CallIdAllocator_Allocate_0100
+ * @tc.name     allocate every id of the id space, test Allocate(), return distinct valid ids, then ERR_ID
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Allocate_0100, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    std::set<int32_t> callIds;
+    for (int32_t i = 0; i < CALL_ID_NUM; ++i) {
+        int32_t callId = allocator.Allocate();
+        EXPECT_GT(callId, CALL_START_ID);
+        EXPECT_LT(callId, CALL_ID_SPACE_SIZE);
+        callIds.insert(callId);
+    }
+    EXPECT_EQ(callIds.size(), static_cast<size_t>(CALL_ID_NUM));
+    EXPECT_EQ(allocator.Allocate(), ERR_ID);
+}
+
+/**
+ * @tc.number   Telephony_CallIdAllocator_Allocate_0200
+ * @tc.name     release an id while other ids are free, test Allocate(), the released id is not handed out
+ *              again until every other id is in use
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Allocate_0200, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    int32_t releasedId = allocator.Allocate();
+    allocator.Release(releasedId);
+    for (int32_t i = 0; i < CALL_ID_NUM - 1; ++i) {
+        EXPECT_NE(allocator.Allocate(), releasedId);
+    }
+    EXPECT_EQ(allocator.Allocate(), releasedId);
+}
+
+/**
+ * @tc.number   Telephony_CallIdAllocator_Allocate_0300
+ * @tc.name     release two ids while all others are in use, test Allocate(), the ids leave the quarantine
+ *              early in the order they were released
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Allocate_0300, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    AllocateAll(allocator);
+    const int32_t firstId = CALL_START_ID + 5;
+    const int32_t secondId = CALL_START_ID + 3;
+    allocator.Release(firstId);
+    allocator.Release(secondId);
+    EXPECT_EQ(allocator.Allocate(), firstId);
+    EXPECT_EQ(allocator.Allocate(), secondId);
+    EXPECT_EQ(allocator.Allocate(), ERR_ID);
+}
+
+/********************************************* Test Reserve() ***********************************************/
+/**
+ * @tc.number   Telephony_CallIdAllocator_Reserve_0100
+ * @tc.name     reserve a free id, test Reserve(), return true and Allocate() never hands the id out
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Reserve_0100, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    const int32_t reservedId = CALL_START_ID + 1;
+    EXPECT_TRUE(allocator.Reserve(reservedId));
+    for (int32_t i = 0; i < CALL_ID_NUM - 1; ++i) {
+        EXPECT_NE(allocator.Allocate(), reservedId);
+    }
+    EXPECT_EQ(allocator.Allocate(), ERR_ID);
+}
+
+/**
+ * @tc.number   Telephony_CallIdAllocator_Reserve_0200
+ * @tc.name     reserve an id in use or out of the id space, test Reserve(), return false
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Reserve_0200, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    int32_t callId = allocator.Allocate();
+    EXPECT_FALSE(allocator.Reserve(callId));
+    EXPECT_FALSE(allocator.Reserve(CALL_START_ID));
+    EXPECT_FALSE(allocator.Reserve(CALL_ID_SPACE_SIZE));
+}
+
+/********************************************* Test Release() ***********************************************/
+/**
+ * @tc.number   Telephony_CallIdAllocator_Release_0100
+ * @tc.name     release an id that is not allocated, test Release(), the id space is unchanged
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallIdAllocatorGtest, Telephony_CallIdAllocator_Release_0100, Function | MediumTest | Level1)
+{
+    CallIdAllocator allocator;
+    AllocateAll(allocator);
+    allocator.Release(CALL_ID_SPACE_SIZE);
+    allocator.Release(ERR_ID);
+    EXPECT_EQ(allocator.Allocate(), ERR_ID);
+    const int32_t callId = CALL_START_ID + 1;
+    allocator.Release(callId);
+    allocator.Release(callId);
+    EXPECT_EQ(allocator.Allocate(), callId);
+    EXPECT_EQ(allocator.Allocate(), ERR_ID);
+}
+} // namespace Telephony
+} // namespace OHOS
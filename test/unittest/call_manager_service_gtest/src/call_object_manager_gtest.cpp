@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "call_manager_errors.h"
+#include "call_object_manager.h"
+#include "cs_call.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t SLOT_ID_0 = 0;
+constexpr int32_t SLOT_ID_1 = 1;
+constexpr int32_t CALL_INDEX_1 = 1;
+constexpr int32_t CALL_INDEX_2 = 2;
+const std::string PHONE_NUMBER_1 = "13800000001";
+const std::string PHONE_NUMBER_2 = "13800000002";
+
+class CallObjectManagerGtest : public testing::Test {
+public:
+    void TearDown()
+    {
+        for (auto &call : callList_) {
+            CallObjectManager::DeleteOneCallObject(call);
+        }
+        callList_.clear();
+    }
+
+    sptr<CallBase> AddCall(int32_t slotId, int32_t index, const std::string &number)
+    {
+        DialParaInfo info;
+        info.callId = CallObjectManager::GetNewCallId();
+        info.accountId = slotId;
+        info.index = index;
+        info.number = number;
+        info.callType = CallType::TYPE_CS;
+        info.callState = TelCallState::CALL_STATUS_IDLE;
+        sptr<CallBase> call = new CSCall(info);
+        if (CallObjectManager::AddOneCallObject(call) != TELEPHONY_SUCCESS) {
+            return nullptr;
+        }
+        callList_.emplace_back(call);
+        return call;
+    }
+
+private:
+    std::vector<sptr<CallBase>> callList_;
+};
+
+/******************************************* Test GetOneCallObject() *********************************************/
+/**
+ * @tc.number   Telephony_CallObjectManager_GetOneCallObject_0100
+ * @tc.name     add a call, test GetOneCallObject() by call id, return the call, and nullptr once it is deleted
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetOneCallObject_0100, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(callId), call);
+    EXPECT_TRUE(CallObjectManager::IsCallExist(callId));
+    EXPECT_EQ(CallObjectManager::DeleteOneCallObject(callId), TELEPHONY_SUCCESS);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(callId), nullptr);
+    EXPECT_FALSE(CallObjectManager::IsCallExist(callId));
+}
+
+/**
+ * @tc.number   Telephony_CallObjectManager_GetOneCallObject_0200
+ * @tc.name     add calls with the same index on both slots, test GetOneCallObject() by slot and index,
+ *              return the call of the slot
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetOneCallObject_0200, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call0 = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    sptr<CallBase> call1 = AddCall(SLOT_ID_1, CALL_INDEX_1, PHONE_NUMBER_2);
+    ASSERT_NE(call0, nullptr);
+    ASSERT_NE(call1, nullptr);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_0, CALL_INDEX_1), call0);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_1, CALL_INDEX_1), call1);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_0, CALL_INDEX_2), nullptr);
+    CallObjectManager::DeleteOneCallObject(call0);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_0, CALL_INDEX_1), nullptr);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_1, CALL_INDEX_1), call1);
+}
+
+/**
+ * @tc.number   Telephony_CallObjectManager_GetOneCallObject_0300
+ * @tc.name     add a call, test GetOneCallObject() by the number with separators, return the call
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetOneCallObject_0300, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    ASSERT_NE(call, nullptr);
+    std::string number = PHONE_NUMBER_1;
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(number), call);
+    std::string formattedNumber = "(138) 0000-0001";
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(formattedNumber), call);
+    EXPECT_TRUE(CallObjectManager::IsCallExist(formattedNumber));
+    std::string otherNumber = PHONE_NUMBER_2;
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(otherNumber), nullptr);
+}
+
+/**
+ * @tc.number   Telephony_CallObjectManager_GetOneCallObject_0400
+ * @tc.name     add calls of the same number on both slots, test GetOneCallObject() by number,
+ *              return the call added first until it is deleted
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetOneCallObject_0400, Function | MediumTest | Level1)
+{
+    sptr<CallBase> firstCall = AddCall(SLOT_ID_1, CALL_INDEX_1, PHONE_NUMBER_1);
+    sptr<CallBase> secondCall = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    ASSERT_NE(firstCall, nullptr);
+    ASSERT_NE(secondCall, nullptr);
+    std::string number = PHONE_NUMBER_1;
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(number), firstCall);
+    CallObjectManager::DeleteOneCallObject(firstCall);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(number), secondCall);
+}
+
+/**
+ * @tc.number   Telephony_CallObjectManager_AddOneCallObject_0100
+ * @tc.name     add a call whose id is already registered, test AddOneCallObject(),
+ *              return CALL_ERR_PHONE_CALL_ALREADY_EXISTS
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_AddOneCallObject_0100, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    ASSERT_NE(call, nullptr);
+    DialParaInfo info;
+    info.callId = call->GetCallID();
+    info.accountId = SLOT_ID_1;
+    info.index = CALL_INDEX_2;
+    info.number = PHONE_NUMBER_2;
+    info.callType = CallType::TYPE_CS;
+    info.callState = TelCallState::CALL_STATUS_IDLE;
+    sptr<CallBase> sameIdCall = new CSCall(info);
+    EXPECT_EQ(CallObjectManager::AddOneCallObject(sameIdCall), CALL_ERR_PHONE_CALL_ALREADY_EXISTS);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(SLOT_ID_1, CALL_INDEX_2), nullptr);
+    EXPECT_EQ(CallObjectManager::GetCallObjectNum(), 1);
+}
+
+/******************************************* Test GetCallInfoList() *********************************************/
+/**
+ * @tc.number   Telephony_CallObjectManager_GetCallInfoList_0100
+ * @tc.name     add calls on both slots, test GetCallInfoList(), return only the calls of the slot
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetCallInfoList_0100, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call0 = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    sptr<CallBase> call1 = AddCall(SLOT_ID_1, CALL_INDEX_1, PHONE_NUMBER_2);
+    ASSERT_NE(call0, nullptr);
+    ASSERT_NE(call1, nullptr);
+    std::vector<CallAttributeInfo> callVec = CallObjectManager::GetCallInfoList(SLOT_ID_1);
+    ASSERT_EQ(callVec.size(), 1u);
+    EXPECT_EQ(callVec[0].callId, call1->GetCallID());
+    EXPECT_EQ(CallObjectManager::GetCallObjectNum(), 2);
+}
+
+/**
+ * @tc.number   Telephony_CallObjectManager_GetCallSnapshotInfoList_0100
+ * @tc.name     add calls alternating between the slots, test GetCallSnapshotInfoList(),
+ *              return the calls in the order they were added
+ * @tc.desc     Function test
+ */
+HWTEST_F(
+    CallObjectManagerGtest, Telephony_CallObjectManager_GetCallSnapshotInfoList_0100, Function | MediumTest | Level1)
+{
+    sptr<CallBase> firstCall = AddCall(SLOT_ID_1, CALL_INDEX_1, PHONE_NUMBER_1);
+    sptr<CallBase> secondCall = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_2);
+    sptr<CallBase> thirdCall = AddCall(SLOT_ID_1, CALL_INDEX_2, PHONE_NUMBER_2);
+    ASSERT_NE(thirdCall, nullptr);
+    std::vector<CallSnapshotInfo> callList;
+    EXPECT_EQ(CallObjectManager::GetCallSnapshotInfoList(callList), TELEPHONY_SUCCESS);
+    ASSERT_EQ(callList.size(), 3u);
+    EXPECT_EQ(callList[0].info.callId, firstCall->GetCallID());
+    EXPECT_EQ(callList[1].info.callId, secondCall->GetCallID());
+    EXPECT_EQ(callList[2].info.callId, thirdCall->GetCallID());
+}
+
+/******************************************* Test the state counters *********************************************/
+/**
+ * @tc.number   Telephony_CallObjectManager_GetCallNum_0100
+ * @tc.name     move calls between states, test GetCallNum() and IsCallExist(), follow every state change
+ *              and drop a call once it is deleted
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallObjectManagerGtest, Telephony_CallObjectManager_GetCallNum_0100, Function | MediumTest | Level1)
+{
+    sptr<CallBase> call0 = AddCall(SLOT_ID_0, CALL_INDEX_1, PHONE_NUMBER_1);
+    sptr<CallBase> call1 = AddCall(SLOT_ID_1, CALL_INDEX_1, PHONE_NUMBER_2);
+    ASSERT_NE(call0, nullptr);
+    ASSERT_NE(call1, nullptr);
+    call0->SetTelCallState(TelCallState::CALL_STATUS_ACTIVE);
+    call1->SetTelCallState(TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(CallObjectManager::GetCallNum(TelCallState::CALL_STATUS_ACTIVE), 2);
+    call0->SetTelCallState(TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(CallObjectManager::GetCallNum(TelCallState::CALL_STATUS_ACTIVE), 1);
+    EXPECT_EQ(CallObjectManager::GetCallNum(TelCallState::CALL_STATUS_HOLDING), 1);
+    int32_t callId = ERR_ID;
+    EXPECT_TRUE(CallObjectManager::IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId));
+    EXPECT_EQ(callId, call0->GetCallID());
+    CallObjectManager::DeleteOneCallObject(call0);
+    EXPECT_EQ(CallObjectManager::GetCallNum(TelCallState::CALL_STATUS_HOLDING), 0);
+    EXPECT_FALSE(CallObjectManager::IsCallExist(TelCallState::CALL_STATUS_HOLDING));
+    EXPECT_EQ(CallObjectManager::GetCallNum(TelCallState::CALL_STATUS_ACTIVE), 1);
+}
+} // namespace Telephony
+} // namespace OHOS
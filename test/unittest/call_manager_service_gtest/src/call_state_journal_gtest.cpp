@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "securec.h"
+
+#define private public
+#include "call_state_journal.h"
+#include "call_status_manager.h"
+#undef private
+#include "call_manager_errors.h"
+#include "call_object_manager.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t JOURNAL_CALL_ID_1 = 1;
+constexpr int32_t JOURNAL_CALL_ID_2 = 2;
+constexpr int32_t JOURNAL_CALL_INDEX = 1;
+// a journal written later than the current boot time comes from before a reboot
+constexpr int64_t JOURNAL_REBOOT_OFFSET_MS = 1000;
+const std::string JOURNAL_PHONE_NUMBER = "13800000001";
+
+/**
+ * the journal runs on a buffer of the test instead of the file of the service, so the records of a
+ * running service are never touched. The calls restored by Recover() journal into the same buffer.
+ */
+class CallStateJournalGtest : public testing::Test {
+public:
+    void SetUp()
+    {
+        journal_ = DelayedSingleton<CallStateJournal>::GetInstance();
+        buffer_.assign(sizeof(CallJournalHeader) + sizeof(CallJournalRecord) * CALL_JOURNAL_RECORD_NUM, 0);
+        std::lock_guard<std::mutex> lock(journal_->mutex_);
+        journal_->header_ = reinterpret_cast<CallJournalHeader *>(buffer_.data());
+        journal_->records_ = reinterpret_cast<CallJournalRecord *>(buffer_.data() + sizeof(CallJournalHeader));
+        journal_->ResetLocked();
+    }
+
+    void TearDown()
+    {
+        CallObjectManager::DeleteOneCallObject(JOURNAL_CALL_ID_1);
+        CallObjectManager::DeleteOneCallObject(JOURNAL_CALL_ID_2);
+        std::lock_guard<std::mutex> lock(journal_->mutex_);
+        journal_->header_ = nullptr;
+        journal_->records_ = nullptr;
+    }
+
+    void AppendCreated(int32_t callId, TelCallState state)
+    {
+        CallJournalRecord record;
+        (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+        record.eventType = CALL_JOURNAL_EVENT_CREATE;
+        record.callId = callId;
+        record.index = JOURNAL_CALL_INDEX;
+        record.callType = static_cast<int32_t>(CallType::TYPE_CS);
+        record.callDirection = static_cast<int32_t>(CallDirection::CALL_DIRECTION_IN);
+        record.callState = static_cast<int32_t>(state);
+        record.conferenceState = static_cast<int32_t>(TelConferenceState::TEL_CONFERENCE_IDLE);
+        (void)memcpy_s(record.accountNumber, kMaxNumberLen, JOURNAL_PHONE_NUMBER.c_str(),
+            JOURNAL_PHONE_NUMBER.length());
+        Append(record);
+    }
+
+    void AppendStateChanged(int32_t callId, TelCallState state)
+    {
+        CallJournalRecord record;
+        (void)memset_s(&record, sizeof(CallJournalRecord), 0, sizeof(CallJournalRecord));
+        record.eventType = CALL_JOURNAL_EVENT_STATE_CHANGE;
+        record.callId = callId;
+        record.callState = static_cast<int32_t>(state);
+        record.conferenceState = static_cast<int32_t>(TelConferenceState::TEL_CONFERENCE_IDLE);
+        Append(record);
+    }
+
+    void AppendDestroyed(int32_t callId)
+    {
+        CallJournalRecord record;
+        CallStateJournal::FillCallDestroyedRecord(record, callId);
+        Append(record);
+    }
+
+    void Append(CallJournalRecord &record)
+    {
+        std::unique_lock<std::mutex> orderLock;
+        journal_->Append(record, orderLock);
+    }
+
+    void Replay(std::vector<CallJournalRecord> &callRecords)
+    {
+        std::lock_guard<std::mutex> lock(journal_->mutex_);
+        journal_->ReplayLocked(callRecords);
+    }
+
+    uint32_t GetRecordNum()
+    {
+        return journal_->header_->recordNum;
+    }
+
+protected:
+    std::shared_ptr<CallStateJournal> journal_;
+    std::vector<char> buffer_;
+};
+
+/******************************************* Test the journal replay *********************************************/
+/**
+ * @tc.number   Telephony_CallStateJournal_Replay_0100
+ * @tc.name     append the events of a live and a destroyed call, test the replay, return only the live call
+ *              with its latest states
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Replay_0100, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_INCOMING);
+    AppendCreated(JOURNAL_CALL_ID_2, TelCallState::CALL_STATUS_DIALING);
+    AppendStateChanged(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    journal_->RecordConferenceStateChanged(JOURNAL_CALL_ID_1, TelConferenceState::TEL_CONFERENCE_ACTIVE);
+    AppendDestroyed(JOURNAL_CALL_ID_2);
+    std::vector<CallJournalRecord> callRecords;
+    Replay(callRecords);
+    ASSERT_EQ(callRecords.size(), 1u);
+    EXPECT_EQ(callRecords[0].callId, JOURNAL_CALL_ID_1);
+    EXPECT_EQ(callRecords[0].callState, static_cast<int32_t>(TelCallState::CALL_STATUS_ACTIVE));
+    EXPECT_EQ(callRecords[0].conferenceState, static_cast<int32_t>(TelConferenceState::TEL_CONFERENCE_ACTIVE));
+    EXPECT_STREQ(callRecords[0].accountNumber, JOURNAL_PHONE_NUMBER.c_str());
+}
+
+/**
+ * @tc.number   Telephony_CallStateJournal_Replay_0200
+ * @tc.name     tear the magic of a record as a crash during the append would, test the replay,
+ *              the records from the torn one on are not replayed
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Replay_0200, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    AppendStateChanged(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_HOLDING);
+    AppendCreated(JOURNAL_CALL_ID_2, TelCallState::CALL_STATUS_INCOMING);
+    journal_->records_[1].magic = 0;
+    std::vector<CallJournalRecord> callRecords;
+    Replay(callRecords);
+    ASSERT_EQ(callRecords.size(), 1u);
+    EXPECT_EQ(callRecords[0].callId, JOURNAL_CALL_ID_1);
+    EXPECT_EQ(callRecords[0].callState, static_cast<int32_t>(TelCallState::CALL_STATUS_ACTIVE));
+}
+
+/**
+ * @tc.number   Telephony_CallStateJournal_Append_0100
+ * @tc.name     destroy a call, test Append(), the number of the call is wiped from its create record
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Append_0100, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_STREQ(journal_->records_[0].accountNumber, JOURNAL_PHONE_NUMBER.c_str());
+    AppendDestroyed(JOURNAL_CALL_ID_1);
+    EXPECT_EQ(GetRecordNum(), 2u);
+    EXPECT_STREQ(journal_->records_[0].accountNumber, "");
+}
+
+/**
+ * @tc.number   Telephony_CallStateJournal_Compact_0100
+ * @tc.name     fill the journal with state changes, test the compaction, the journal is folded into one record
+ *              per live call and the replay still returns the latest states
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Compact_0100, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    AppendCreated(JOURNAL_CALL_ID_2, TelCallState::CALL_STATUS_INCOMING);
+    AppendDestroyed(JOURNAL_CALL_ID_2);
+    while (GetRecordNum() < CALL_JOURNAL_RECORD_NUM) {
+        AppendStateChanged(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    }
+    AppendStateChanged(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(GetRecordNum(), 2u);
+    std::vector<CallJournalRecord> callRecords;
+    Replay(callRecords);
+    ASSERT_EQ(callRecords.size(), 1u);
+    EXPECT_EQ(callRecords[0].callId, JOURNAL_CALL_ID_1);
+    EXPECT_EQ(callRecords[0].callState, static_cast<int32_t>(TelCallState::CALL_STATUS_HOLDING));
+    EXPECT_STREQ(callRecords[0].accountNumber, JOURNAL_PHONE_NUMBER.c_str());
+}
+
+/********************************************* Test Recover() ***********************************************/
+/**
+ * @tc.number   Telephony_CallStateJournal_Recover_0100
+ * @tc.name     journal a live and an ended call, test Recover(), return 0 and only the live call is restored
+ *              to the registry with its journaled state
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Recover_0100, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_INCOMING);
+    AppendStateChanged(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    AppendCreated(JOURNAL_CALL_ID_2, TelCallState::CALL_STATUS_DIALING);
+    AppendStateChanged(JOURNAL_CALL_ID_2, TelCallState::CALL_STATUS_DISCONNECTED);
+    EXPECT_EQ(journal_->Recover(), TELEPHONY_SUCCESS);
+    EXPECT_EQ(journal_->GetRecoveredCallNum(), 1);
+    sptr<CallBase> call = CallObjectManager::GetOneCallObject(JOURNAL_CALL_ID_1);
+    ASSERT_NE(call, nullptr);
+    EXPECT_EQ(call->GetTelCallState(), TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(JOURNAL_CALL_ID_2), nullptr);
+    // the restored call journals itself again, so a second restart recovers it as well
+    std::vector<CallJournalRecord> callRecords;
+    Replay(callRecords);
+    ASSERT_EQ(callRecords.size(), 1u);
+    EXPECT_EQ(callRecords[0].callId, JOURNAL_CALL_ID_1);
+}
+
+/**
+ * @tc.number   Telephony_CallStateJournal_Recover_0200
+ * @tc.name     recover a call that ended while the service was down, test the first call list report of its slot,
+ *              the recovered call is reported as vanished
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Recover_0200, Function | MediumTest | Level1)
+{
+    // made before the recovery as the service does, constructing a registry user clears the registry
+    CallStatusManager callStatusManager;
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(journal_->Recover(), TELEPHONY_SUCCESS);
+    ASSERT_NE(CallObjectManager::GetOneCallObject(JOURNAL_CALL_ID_1), nullptr);
+    CallDetailsInfo info;
+    info.slotId = 0;
+    std::vector<CallStatusManager::CallReportChange> changes;
+    callStatusManager.DiffCallsReportInfo(info, changes);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_VANISHED);
+    EXPECT_EQ(changes[0].info.index, JOURNAL_CALL_INDEX);
+    EXPECT_EQ(changes[0].info.state, TelCallState::CALL_STATUS_DISCONNECTED);
+}
+
+/**
+ * @tc.number   Telephony_CallStateJournal_Recover_0300
+ * @tc.name     journal a call before the device rebooted, test Recover(), return 0 and no call is restored
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateJournalGtest, Telephony_CallStateJournal_Recover_0300, Function | MediumTest | Level1)
+{
+    AppendCreated(JOURNAL_CALL_ID_1, TelCallState::CALL_STATUS_ACTIVE);
+    journal_->header_->updateTime = journal_->GetBootTime() + JOURNAL_REBOOT_OFFSET_MS;
+    EXPECT_EQ(journal_->Recover(), TELEPHONY_SUCCESS);
+    EXPECT_EQ(journal_->GetRecoveredCallNum(), 0);
+    EXPECT_EQ(CallObjectManager::GetOneCallObject(JOURNAL_CALL_ID_1), nullptr);
+    EXPECT_EQ(GetRecordNum(), 0u);
+}
+} // namespace Telephony
+} // namespace OHOS
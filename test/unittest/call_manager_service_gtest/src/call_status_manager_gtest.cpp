@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "securec.h"
+
+#define private public
+#include "call_status_manager.h"
+#undef private
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t REPORT_SLOT_ID_0 = 0;
+constexpr int32_t REPORT_SLOT_ID_1 = 1;
+constexpr int32_t REPORT_CALL_INDEX_1 = 1;
+constexpr int32_t REPORT_CALL_INDEX_2 = 2;
+const std::string REPORT_PHONE_NUMBER_1 = "13800000001";
+const std::string REPORT_PHONE_NUMBER_2 = "13800000002";
+
+class CallStatusManagerGtest : public testing::Test {
+public:
+    using CallReportChange = CallStatusManager::CallReportChange;
+
+    static CallDetailInfo MakeCallInfo(int32_t index, const std::string &number, TelCallState state)
+    {
+        CallDetailInfo info;
+        (void)memset_s(&info, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
+        info.index = index;
+        (void)memcpy_s(info.phoneNum, kMaxNumberLen, number.c_str(), number.length());
+        info.callType = CallType::TYPE_CS;
+        info.state = state;
+        return info;
+    }
+
+    std::vector<CallReportChange> Diff(int32_t slotId, const std::vector<CallDetailInfo> &callVec)
+    {
+        CallDetailsInfo info;
+        info.slotId = slotId;
+        info.callVec = callVec;
+        std::vector<CallReportChange> changes;
+        callStatusManager_.DiffCallsReportInfo(info, changes);
+        return changes;
+    }
+
+protected:
+    CallStatusManager callStatusManager_;
+};
+
+/**************************************** Test DiffCallsReportInfo() ******************************************/
+/**
+ * @tc.number   Telephony_CallStatusManager_DiffCallsReportInfo_0100
+ * @tc.name     report a call list for the first time, test DiffCallsReportInfo(), return every call as created
+ *              in report order, and nothing when the same list is reported again
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStatusManagerGtest, Telephony_CallStatusManager_DiffCallsReportInfo_0100,
+    Function | MediumTest | Level1)
+{
+    std::vector<CallDetailInfo> callVec = {
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_ACTIVE),
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_HOLDING),
+    };
+    std::vector<CallReportChange> changes = Diff(REPORT_SLOT_ID_0, callVec);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_CREATED);
+    EXPECT_EQ(changes[0].info.index, REPORT_CALL_INDEX_2);
+    EXPECT_EQ(changes[1].type, CallStatusManager::CALL_REPORT_CREATED);
+    EXPECT_EQ(changes[1].info.index, REPORT_CALL_INDEX_1);
+    EXPECT_TRUE(Diff(REPORT_SLOT_ID_0, callVec).empty());
+}
+
+/**
+ * @tc.number   Telephony_CallStatusManager_DiffCallsReportInfo_0200
+ * @tc.name     change the state of one of two calls, test DiffCallsReportInfo(), return only that call as changed
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStatusManagerGtest, Telephony_CallStatusManager_DiffCallsReportInfo_0200,
+    Function | MediumTest | Level1)
+{
+    Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_ACTIVE),
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_WAITING),
+    });
+    std::vector<CallReportChange> changes = Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_HOLDING),
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_WAITING),
+    });
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_CHANGED);
+    EXPECT_EQ(changes[0].info.index, REPORT_CALL_INDEX_1);
+    EXPECT_EQ(changes[0].info.state, TelCallState::CALL_STATUS_HOLDING);
+}
+
+/**
+ * @tc.number   Telephony_CallStatusManager_DiffCallsReportInfo_0300
+ * @tc.name     leave a call out of the next list, test DiffCallsReportInfo(), return the changes of the list
+ *              followed by the missing call as vanished and disconnected
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStatusManagerGtest, Telephony_CallStatusManager_DiffCallsReportInfo_0300,
+    Function | MediumTest | Level1)
+{
+    Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_ACTIVE),
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_HOLDING),
+    });
+    std::vector<CallReportChange> changes = Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_ACTIVE),
+    });
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_CHANGED);
+    EXPECT_EQ(changes[0].info.index, REPORT_CALL_INDEX_2);
+    EXPECT_EQ(changes[1].type, CallStatusManager::CALL_REPORT_VANISHED);
+    EXPECT_EQ(changes[1].info.index, REPORT_CALL_INDEX_1);
+    EXPECT_EQ(changes[1].info.state, TelCallState::CALL_STATUS_DISCONNECTED);
+    EXPECT_TRUE(Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_2, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_ACTIVE),
+    }).empty());
+}
+
+/**
+ * @tc.number   Telephony_CallStatusManager_DiffCallsReportInfo_0400
+ * @tc.name     report another number under the index of a call, test DiffCallsReportInfo(),
+ *              return the old call as vanished before the new one is created
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStatusManagerGtest, Telephony_CallStatusManager_DiffCallsReportInfo_0400,
+    Function | MediumTest | Level1)
+{
+    Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_ACTIVE),
+    });
+    std::vector<CallReportChange> changes = Diff(REPORT_SLOT_ID_0, {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_2, TelCallState::CALL_STATUS_INCOMING),
+    });
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_VANISHED);
+    EXPECT_STREQ(changes[0].info.phoneNum, REPORT_PHONE_NUMBER_1.c_str());
+    EXPECT_EQ(changes[0].info.state, TelCallState::CALL_STATUS_DISCONNECTED);
+    EXPECT_EQ(changes[1].type, CallStatusManager::CALL_REPORT_CREATED);
+    EXPECT_STREQ(changes[1].info.phoneNum, REPORT_PHONE_NUMBER_2.c_str());
+}
+
+/**
+ * @tc.number   Telephony_CallStatusManager_DiffCallsReportInfo_0500
+ * @tc.name     report an empty list on the other slot, test DiffCallsReportInfo(),
+ *              the calls of the first slot are kept
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStatusManagerGtest, Telephony_CallStatusManager_DiffCallsReportInfo_0500,
+    Function | MediumTest | Level1)
+{
+    std::vector<CallDetailInfo> callVec = {
+        MakeCallInfo(REPORT_CALL_INDEX_1, REPORT_PHONE_NUMBER_1, TelCallState::CALL_STATUS_ACTIVE),
+    };
+    Diff(REPORT_SLOT_ID_0, callVec);
+    EXPECT_TRUE(Diff(REPORT_SLOT_ID_1, {}).empty());
+    EXPECT_TRUE(Diff(REPORT_SLOT_ID_0, callVec).empty());
+    std::vector<CallReportChange> changes = Diff(REPORT_SLOT_ID_0, {});
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].type, CallStatusManager::CALL_REPORT_VANISHED);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "securec.h"
+
+#define private public
+#include "cellular_call_dtmf_sender.h"
+#undef private
+
+#include "call_manager_errors.h"
+#include "call_object_manager.h"
+#include "cs_call.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t DTMF_SLOT_ID = 0;
+constexpr int32_t DTMF_CALL_INDEX_1 = 1;
+constexpr int32_t DTMF_CALL_INDEX_2 = 2;
+constexpr int32_t DTMF_ON_LENGTH = 150;
+constexpr int32_t DTMF_OFF_LENGTH = 70;
+
+class CellularCallDtmfSenderGtest : public testing::Test {
+public:
+    void SetUp()
+    {
+        // a runner without a thread keeps the events queued, the tests play the string step by step
+        runner_ = AppExecFwk::EventRunner::Create(false);
+        sender_ = std::make_shared<CellularCallDtmfSender>(runner_);
+    }
+
+    void TearDown()
+    {
+        sender_ = nullptr;
+        runner_ = nullptr;
+        for (auto &call : callList_) {
+            CallObjectManager::DeleteOneCallObject(call);
+        }
+        callList_.clear();
+    }
+
+    sptr<CallBase> AddCall(int32_t index)
+    {
+        DialParaInfo info;
+        info.callId = CallObjectManager::GetNewCallId();
+        info.accountId = DTMF_SLOT_ID;
+        info.index = index;
+        info.callType = CallType::TYPE_CS;
+        info.callState = TelCallState::CALL_STATUS_ACTIVE;
+        sptr<CallBase> call = new CSCall(info);
+        if (CallObjectManager::AddOneCallObject(call) != TELEPHONY_SUCCESS) {
+            return nullptr;
+        }
+        callList_.emplace_back(call);
+        return call;
+    }
+
+    CellularCallInfo GetCallInfo(int32_t callId, int32_t index)
+    {
+        CellularCallInfo callInfo;
+        (void)memset_s(&callInfo, sizeof(CellularCallInfo), 0, sizeof(CellularCallInfo));
+        callInfo.callId = callId;
+        callInfo.slotId = DTMF_SLOT_ID;
+        callInfo.index = index;
+        callInfo.callType = CallType::TYPE_CS;
+        return callInfo;
+    }
+
+    int32_t AddString(const std::string &dtmfString, const CellularCallInfo &callInfo)
+    {
+        return sender_->AddString(dtmfString, callInfo, DTMF_ON_LENGTH, DTMF_OFF_LENGTH);
+    }
+
+    uint64_t GetSerial(int32_t callId)
+    {
+        auto it = sender_->dtmfStrings_.find(callId);
+        return it == sender_->dtmfStrings_.end() ? 0 : it->second.serial;
+    }
+
+protected:
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<CellularCallDtmfSender> sender_;
+
+private:
+    std::vector<sptr<CallBase>> callList_;
+};
+
+/************************************** Test AddString() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_AddString_0100
+ * @tc.name     add a string with an invalid char and an empty string without a waiting string,
+ *              test AddString(), both are rejected
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_AddString_0100,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    CellularCallInfo callInfo = GetCallInfo(call->GetCallID(), DTMF_CALL_INDEX_1);
+    EXPECT_EQ(AddString("1X", callInfo), TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_EQ(AddString("", callInfo), TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_TRUE(sender_->dtmfStrings_.empty());
+}
+
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_AddString_0200
+ * @tc.name     add a string for a call id given to another call, test AddString(), the string of the
+ *              earlier call is dropped
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_AddString_0200,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    EXPECT_EQ(AddString("p", GetCallInfo(callId, DTMF_CALL_INDEX_1)), TELEPHONY_SUCCESS);
+    uint64_t serial = GetSerial(callId);
+    EXPECT_EQ(AddString("w", GetCallInfo(callId, DTMF_CALL_INDEX_2)), TELEPHONY_SUCCESS);
+    EXPECT_NE(GetSerial(callId), serial);
+    EXPECT_EQ(sender_->dtmfStrings_[callId].digits, "w");
+    EXPECT_EQ(sender_->dtmfStrings_[callId].callInfo.index, DTMF_CALL_INDEX_2);
+}
+
+/************************************** Test StartTone() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_StartTone_0100
+ * @tc.name     play a string of pause chars, test StartTone(), each pause holds the string without a
+ *              tone and the string is done after the last one
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_StartTone_0100,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    EXPECT_EQ(AddString("p,", GetCallInfo(callId, DTMF_CALL_INDEX_1)), TELEPHONY_SUCCESS);
+    uint64_t serial = GetSerial(callId);
+    sender_->StartTone(serial);
+    EXPECT_EQ(sender_->dtmfStrings_[callId].nextIndex, 1u);
+    EXPECT_FALSE(sender_->dtmfStrings_[callId].isWaiting);
+    EXPECT_EQ(sender_->toneSerial_, 0u);
+    sender_->StartTone(serial);
+    EXPECT_EQ(sender_->dtmfStrings_[callId].nextIndex, 2u);
+    sender_->StartTone(serial);
+    EXPECT_EQ(GetSerial(callId), 0u);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_StartTone_0200
+ * @tc.name     play a string with a wait char, test StartTone(), the string is held until an empty
+ *              string continues it, chars added meanwhile stay held
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_StartTone_0200,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    CellularCallInfo callInfo = GetCallInfo(callId, DTMF_CALL_INDEX_1);
+    EXPECT_EQ(AddString("w", callInfo), TELEPHONY_SUCCESS);
+    uint64_t serial = GetSerial(callId);
+    sender_->StartTone(serial);
+    EXPECT_TRUE(sender_->dtmfStrings_[callId].isWaiting);
+    EXPECT_EQ(AddString("p", callInfo), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(sender_->dtmfStrings_[callId].isWaiting);
+    EXPECT_EQ(sender_->dtmfStrings_[callId].digits, "p");
+    EXPECT_EQ(sender_->dtmfStrings_[callId].nextIndex, 0u);
+    EXPECT_EQ(AddString("", callInfo), TELEPHONY_SUCCESS);
+    EXPECT_FALSE(sender_->dtmfStrings_[callId].isWaiting);
+    EXPECT_EQ(GetSerial(callId), serial);
+    sender_->StartTone(serial);
+    EXPECT_EQ(sender_->dtmfStrings_[callId].nextIndex, 1u);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_StartTone_0300
+ * @tc.name     play a string of a call that is gone, test StartTone(), the string is dropped
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_StartTone_0300,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    EXPECT_EQ(AddString("p", GetCallInfo(callId, DTMF_CALL_INDEX_1)), TELEPHONY_SUCCESS);
+    EXPECT_EQ(CallObjectManager::DeleteOneCallObject(callId), TELEPHONY_SUCCESS);
+    sender_->StartTone(GetSerial(callId));
+    EXPECT_TRUE(sender_->dtmfStrings_.empty());
+}
+
+/************************************** Test RemoveString() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallDtmfSender_RemoveString_0100
+ * @tc.name     remove the string of a call, test RemoveString(), the events of the string find nothing
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallDtmfSenderGtest, Telephony_CellularCallDtmfSender_RemoveString_0100,
+    Function | MediumTest | Level1)
+{
+    sptr<CallBase> call = AddCall(DTMF_CALL_INDEX_1);
+    ASSERT_NE(call, nullptr);
+    int32_t callId = call->GetCallID();
+    EXPECT_EQ(AddString("pw", GetCallInfo(callId, DTMF_CALL_INDEX_1)), TELEPHONY_SUCCESS);
+    uint64_t serial = GetSerial(callId);
+    sender_->RemoveString(callId);
+    EXPECT_TRUE(sender_->dtmfStrings_.empty());
+    sender_->StartTone(serial);
+    sender_->StopTone(serial);
+    EXPECT_TRUE(sender_->dtmfStrings_.empty());
+    EXPECT_EQ(sender_->toneSerial_, 0u);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "cellular_call_request_tracker.h"
+#undef private
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr CallResultReportId TRACKED_REPORT_ID = CallResultReportId::START_DTMF_REPORT_ID;
+constexpr CallResultReportId OTHER_REPORT_ID = CallResultReportId::STOP_DTMF_REPORT_ID;
+constexpr size_t TRACKED_REPORT_INDEX = static_cast<size_t>(TRACKED_REPORT_ID);
+
+class CellularCallRequestTrackerGtest : public testing::Test {
+public:
+    void SetUp()
+    {
+        runner_ = AppExecFwk::EventRunner::Create("CellularCallRequestTrackerGtest");
+        tracker_ = std::make_shared<CellularCallRequestTracker>(runner_);
+    }
+
+    void TearDown()
+    {
+        tracker_ = nullptr;
+        runner_->Stop();
+        runner_ = nullptr;
+    }
+
+    // the timeout events are seconds away, the tests time a request out by handing its event over directly
+    void TimeOutRequest(CallResultReportId reportId, uint64_t requestId)
+    {
+        tracker_->ProcessEvent(
+            AppExecFwk::InnerEvent::Get(static_cast<uint32_t>(reportId), static_cast<int64_t>(requestId)));
+    }
+
+protected:
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<CellularCallRequestTracker> tracker_;
+};
+
+/************************************** Test AddRequest() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_AddRequest_0100
+ * @tc.name     add requests of a report id, test AddRequest(), every request gets its own id
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_AddRequest_0100,
+    Function | MediumTest | Level1)
+{
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    uint64_t firstRequestId = tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    uint64_t secondRequestId = tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    EXPECT_NE(firstRequestId, 0u);
+    EXPECT_NE(firstRequestId, secondRequestId);
+    EXPECT_TRUE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->HasRequest(OTHER_REPORT_ID));
+}
+
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_AddRequest_0200
+ * @tc.name     add a request of an untracked report id, test AddRequest(), it gets no id
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_AddRequest_0200,
+    Function | MediumTest | Level1)
+{
+    CallResultReportId reportId = static_cast<CallResultReportId>(CALL_RESULT_REPORT_ID_NUM);
+    EXPECT_EQ(tracker_->AddRequest(reportId, true), 0u);
+    EXPECT_FALSE(tracker_->HasRequest(reportId));
+    EXPECT_FALSE(tracker_->OnResultReceived(reportId));
+}
+
+/************************************** Test OnResultReceived() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_OnResultReceived_0100
+ * @tc.name     receive the results of a reported and an unreported request, test OnResultReceived(),
+ *              the results match the requests in order and only the first is reported
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_OnResultReceived_0100,
+    Function | MediumTest | Level1)
+{
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_TRUE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+}
+
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_OnResultReceived_0200
+ * @tc.name     receive a result without a request, test OnResultReceived(), it is not reported
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_OnResultReceived_0200,
+    Function | MediumTest | Level1)
+{
+    tracker_->AddRequest(OTHER_REPORT_ID, true);
+    EXPECT_FALSE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_TRUE(tracker_->HasRequest(OTHER_REPORT_ID));
+}
+
+/************************************** Test RemoveRequest() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_RemoveRequest_0100
+ * @tc.name     remove the oldest request of a report id, test RemoveRequest(), the next result matches
+ *              the request after it
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_RemoveRequest_0100,
+    Function | MediumTest | Level1)
+{
+    uint64_t requestId = tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    tracker_->RemoveRequest(TRACKED_REPORT_ID, requestId);
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+}
+
+/************************************** Test ProcessEvent() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_ProcessEvent_0100
+ * @tc.name     time out a request and send another, test ProcessEvent(), the late result of the first
+ *              is dropped instead of matching the second
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_ProcessEvent_0100,
+    Function | MediumTest | Level1)
+{
+    uint64_t requestId = tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    TimeOutRequest(TRACKED_REPORT_ID, requestId);
+    EXPECT_TRUE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    EXPECT_FALSE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+}
+
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_ProcessEvent_0200
+ * @tc.name     time out a request that never gets a result, test ProcessEvent(), once the drop expires
+ *              the next result matches a later request again
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_ProcessEvent_0200,
+    Function | MediumTest | Level1)
+{
+    uint64_t requestId = tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    TimeOutRequest(TRACKED_REPORT_ID, requestId);
+    ASSERT_EQ(tracker_->lateResultDeadlines_[TRACKED_REPORT_INDEX].size(), 1u);
+    tracker_->lateResultDeadlines_[TRACKED_REPORT_INDEX].front() = std::chrono::steady_clock::now();
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+}
+
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_ProcessEvent_0300
+ * @tc.name     time out a request whose result came already, test ProcessEvent(), nothing is dropped
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_ProcessEvent_0300,
+    Function | MediumTest | Level1)
+{
+    uint64_t requestId = tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    EXPECT_FALSE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+    TimeOutRequest(TRACKED_REPORT_ID, requestId);
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+}
+
+/************************************** Test Reset() ****************************************/
+/**
+ * @tc.number   Telephony_CellularCallRequestTracker_Reset_0100
+ * @tc.name     reset with outstanding and timed out requests, test Reset(), nothing is expected any more
+ * @tc.desc     Function test
+ */
+HWTEST_F(CellularCallRequestTrackerGtest, Telephony_CellularCallRequestTracker_Reset_0100,
+    Function | MediumTest | Level1)
+{
+    uint64_t requestId = tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    TimeOutRequest(TRACKED_REPORT_ID, requestId);
+    tracker_->AddRequest(TRACKED_REPORT_ID, false);
+    tracker_->AddRequest(OTHER_REPORT_ID, false);
+    tracker_->Reset();
+    EXPECT_FALSE(tracker_->HasRequest(TRACKED_REPORT_ID));
+    EXPECT_FALSE(tracker_->HasRequest(OTHER_REPORT_ID));
+    tracker_->AddRequest(TRACKED_REPORT_ID, true);
+    EXPECT_TRUE(tracker_->OnResultReceived(TRACKED_REPORT_ID));
+}
+} // namespace Telephony
+} // namespace OHOS
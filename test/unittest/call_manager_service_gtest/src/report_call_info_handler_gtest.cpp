@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "securec.h"
+
+#define private public
+#include "report_call_info_handler.h"
+#undef private
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+constexpr int32_t COALESCE_SLOT_ID = 0;
+constexpr int32_t COALESCE_CALL_INDEX_1 = 1;
+constexpr int32_t COALESCE_CALL_INDEX_2 = 2;
+// the largest window keeps the reports sent at once clearly apart from the held ones
+constexpr int64_t COALESCE_WINDOW_MS = CALL_REPORT_COALESCE_WINDOW_MAX_MS;
+constexpr int64_t COALESCE_SENT_AT_ONCE_MS = COALESCE_WINDOW_MS / 4;
+constexpr int64_t COALESCE_FLUSH_TIMEOUT_MS = COALESCE_WINDOW_MS * 4;
+
+struct SentCallReport {
+    bool isCallList;
+    int32_t index;
+    TelCallState state;
+};
+
+/**
+ * @ClassName:RecordingCallReportHandler
+ * @Description:records the reports the service hands to the handler thread instead of handling them,
+ * the flushes of held reports run as they do in the service.
+ */
+class RecordingCallReportHandler : public ReportCallInfoHandler {
+public:
+    explicit RecordingCallReportHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
+        : ReportCallInfoHandler(runner)
+    {}
+    ~RecordingCallReportHandler() = default;
+
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override
+    {
+        switch (event->GetInnerEventId()) {
+            case ReportCallInfoHandlerService::HANDLER_UPDATE_CELLULAR_CALL_INFO: {
+                auto info = event->GetUniqueObject<CallDetailInfo>();
+                Record({ false, info->index, info->state });
+                break;
+            }
+            case ReportCallInfoHandlerService::HANDLER_UPDATE_CALL_INFO_LIST: {
+                auto info = event->GetUniqueObject<CallDetailsInfo>();
+                Record({ true, CALL_LIST_INDEX, info->callVec.front().state });
+                break;
+            }
+            default:
+                ReportCallInfoHandler::ProcessEvent(event);
+                break;
+        }
+    }
+
+    bool WaitForReports(size_t reportNum, int64_t timeoutMs)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return condition_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+            [this, reportNum]() { return reports_.size() >= reportNum; });
+    }
+
+    std::vector<SentCallReport> GetReports()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reports_;
+    }
+
+    static constexpr int32_t CALL_LIST_INDEX = -1;
+
+private:
+    void Record(const SentCallReport &report)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reports_.emplace_back(report);
+        condition_.notify_all();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<SentCallReport> reports_;
+};
+
+class ReportCallInfoHandlerGtest : public testing::Test {
+public:
+    void SetUp()
+    {
+        service_ = DelayedSingleton<ReportCallInfoHandlerService>::GetInstance();
+        runner_ = AppExecFwk::EventRunner::Create("ReportCallInfoHandlerGtest");
+        handler_ = std::make_shared<RecordingCallReportHandler>(runner_);
+        service_->handler_ = handler_;
+        service_->SetCallReportCoalesceWindow(COALESCE_WINDOW_MS);
+    }
+
+    void TearDown()
+    {
+        // a window of 0 closes the open windows, their flush events are dropped with the runner
+        service_->SetCallReportCoalesceWindow(0);
+        service_->SetCallReportCoalesceWindow(CALL_REPORT_COALESCE_WINDOW_DEFAULT_MS);
+        service_->handler_ = nullptr;
+        handler_ = nullptr;
+        runner_->Stop();
+        runner_ = nullptr;
+    }
+
+    int32_t UpdateCallReport(int32_t index, TelCallState state)
+    {
+        CallDetailInfo info;
+        (void)memset_s(&info, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
+        info.accountId = COALESCE_SLOT_ID;
+        info.index = index;
+        info.callType = CallType::TYPE_CS;
+        info.state = state;
+        return service_->UpdateCallReportInfo(info);
+    }
+
+    int32_t UpdateCallListReport(TelCallState state)
+    {
+        CallDetailsInfo info;
+        info.slotId = COALESCE_SLOT_ID;
+        for (int32_t index : { COALESCE_CALL_INDEX_1, COALESCE_CALL_INDEX_2 }) {
+            CallDetailInfo callInfo;
+            (void)memset_s(&callInfo, sizeof(CallDetailInfo), 0, sizeof(CallDetailInfo));
+            callInfo.accountId = COALESCE_SLOT_ID;
+            callInfo.index = index;
+            callInfo.callType = CallType::TYPE_CS;
+            callInfo.state = state;
+            info.callVec.emplace_back(callInfo);
+        }
+        return service_->UpdateCallsReportInfo(info);
+    }
+
+protected:
+    std::shared_ptr<ReportCallInfoHandlerService> service_;
+    std::shared_ptr<AppExecFwk::EventRunner> runner_;
+    std::shared_ptr<RecordingCallReportHandler> handler_;
+};
+
+/************************************** Test UpdateCallReportInfo() ****************************************/
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0100
+ * @tc.name     report an intermediate state of a call once, test UpdateCallReportInfo(), the report is sent
+ *              at once and not delayed by the coalesce window
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0100,
+    Function | MediumTest | Level1)
+{
+    EXPECT_EQ(UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(handler_->WaitForReports(1, COALESCE_SENT_AT_ONCE_MS));
+}
+
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0200
+ * @tc.name     report three intermediate states of a call in a burst, test UpdateCallReportInfo(), the first
+ *              report is sent at once, the second is replaced and the last is sent when the window ends
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0200,
+    Function | MediumTest | Level1)
+{
+    int64_t suppressedNum = service_->GetSuppressedCallReportNum();
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ALERTING);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_TRUE(handler_->WaitForReports(1, COALESCE_SENT_AT_ONCE_MS));
+    EXPECT_EQ(handler_->GetReports().size(), 1u);
+    EXPECT_TRUE(handler_->WaitForReports(2, COALESCE_FLUSH_TIMEOUT_MS));
+    std::this_thread::sleep_for(std::chrono::milliseconds(COALESCE_WINDOW_MS));
+    std::vector<SentCallReport> reports = handler_->GetReports();
+    ASSERT_EQ(reports.size(), 2u);
+    EXPECT_EQ(reports[0].state, TelCallState::CALL_STATUS_ALERTING);
+    EXPECT_EQ(reports[1].state, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(service_->GetSuppressedCallReportNum(), suppressedNum + 1);
+}
+
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0300
+ * @tc.name     report a terminal state while a report of the call is held, test UpdateCallReportInfo(),
+ *              the held report is sent first and both are sent at once
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0300,
+    Function | MediumTest | Level1)
+{
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_HOLDING);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_DISCONNECTED);
+    EXPECT_TRUE(handler_->WaitForReports(3, COALESCE_SENT_AT_ONCE_MS));
+    std::vector<SentCallReport> reports = handler_->GetReports();
+    ASSERT_EQ(reports.size(), 3u);
+    EXPECT_EQ(reports[0].state, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(reports[1].state, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(reports[2].state, TelCallState::CALL_STATUS_DISCONNECTED);
+}
+
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0400
+ * @tc.name     set the coalesce window to 0, test UpdateCallReportInfo(), every report is sent at once
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallReportInfo_0400,
+    Function | MediumTest | Level1)
+{
+    EXPECT_TRUE(service_->SetCallReportCoalesceWindow(0));
+    int64_t suppressedNum = service_->GetSuppressedCallReportNum();
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_HOLDING);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_TRUE(handler_->WaitForReports(3, COALESCE_SENT_AT_ONCE_MS));
+    EXPECT_EQ(service_->GetSuppressedCallReportNum(), suppressedNum);
+}
+
+/************************************** Test UpdateCallsReportInfo() ****************************************/
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallsReportInfo_0100
+ * @tc.name     report a call list of a slot while a report of one of its calls is held,
+ *              test UpdateCallsReportInfo(), the held report is sent before the list
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallsReportInfo_0100,
+    Function | MediumTest | Level1)
+{
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(UpdateCallListReport(TelCallState::CALL_STATUS_ACTIVE), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(handler_->WaitForReports(3, COALESCE_SENT_AT_ONCE_MS));
+    std::vector<SentCallReport> reports = handler_->GetReports();
+    ASSERT_EQ(reports.size(), 3u);
+    EXPECT_FALSE(reports[0].isCallList);
+    EXPECT_FALSE(reports[1].isCallList);
+    EXPECT_EQ(reports[1].state, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_TRUE(reports[2].isCallList);
+}
+
+/**
+ * @tc.number   Telephony_ReportCallInfoHandler_UpdateCallsReportInfo_0200
+ * @tc.name     report a call of a slot while its call list is held, test UpdateCallReportInfo(),
+ *              the held list is sent before the report of the call
+ * @tc.desc     Function test
+ */
+HWTEST_F(ReportCallInfoHandlerGtest, Telephony_ReportCallInfoHandler_UpdateCallsReportInfo_0200,
+    Function | MediumTest | Level1)
+{
+    UpdateCallListReport(TelCallState::CALL_STATUS_ACTIVE);
+    UpdateCallListReport(TelCallState::CALL_STATUS_HOLDING);
+    UpdateCallReport(COALESCE_CALL_INDEX_1, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_TRUE(handler_->WaitForReports(3, COALESCE_SENT_AT_ONCE_MS));
+    std::vector<SentCallReport> reports = handler_->GetReports();
+    ASSERT_EQ(reports.size(), 3u);
+    EXPECT_TRUE(reports[0].isCallList);
+    EXPECT_TRUE(reports[1].isCallList);
+    EXPECT_EQ(reports[1].state, TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_FALSE(reports[2].isCallList);
+}
+} // namespace Telephony
+} // namespace OHOS
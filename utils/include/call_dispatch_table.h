@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_DISPATCH_TABLE_H
+#define CALL_DISPATCH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @ClassName:CallDispatchTable
+ * @Description:member function table indexed directly by a small contiguous code, the replacement
+ * of the std::map<uint32_t, Func> the stubs and handlers used to fill at runtime. It is built by
+ * the compiler from a list of entries, so lookup is one bounds check and one load and nothing is
+ * allocated at startup. Define the table constexpr, then a bad entry list fails the build.
+ */
+template<typename Func, uint32_t CODE_NUM>
+class CallDispatchTable {
+public:
+    struct Entry {
+        uint32_t code;
+        Func func;
+    };
+
+    template<size_t ENTRY_NUM>
+    constexpr explicit CallDispatchTable(const Entry (&entries)[ENTRY_NUM])
+        : CallDispatchTable(entries, std::make_index_sequence<CODE_NUM>())
+    {
+        if (!IsValidEntries(entries)) {
+            // not constexpr, so reaching it while the compiler builds the table is a compile error
+            OnInvalidEntries();
+        }
+    }
+
+    constexpr Func Find(uint32_t code) const
+    {
+        return code < CODE_NUM ? funcs_[code] : nullptr;
+    }
+
+    static constexpr uint32_t GetCodeNum()
+    {
+        return CODE_NUM;
+    }
+
+private:
+    template<size_t ENTRY_NUM, size_t... CODES>
+    constexpr CallDispatchTable(const Entry (&entries)[ENTRY_NUM], std::index_sequence<CODES...>)
+        : funcs_ { FindEntry(entries, CODES)... }
+    {}
+
+    template<size_t ENTRY_NUM>
+    static constexpr Func FindEntry(const Entry (&entries)[ENTRY_NUM], size_t code)
+    {
+        for (size_t i = 0; i < ENTRY_NUM; ++i) {
+            if (entries[i].code == code) {
+                return entries[i].func;
+            }
+        }
+        return nullptr;
+    }
+
+    // every code in range and given once
+    template<size_t ENTRY_NUM>
+    static constexpr bool IsValidEntries(const Entry (&entries)[ENTRY_NUM])
+    {
+        for (size_t i = 0; i < ENTRY_NUM; ++i) {
+            if (entries[i].code >= CODE_NUM || entries[i].func == nullptr) {
+                return false;
+            }
+            for (size_t j = i + 1; j < ENTRY_NUM; ++j) {
+                if (entries[i].code == entries[j].code) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static void OnInvalidEntries() {}
+
+    Func funcs_[CODE_NUM];
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_DISPATCH_TABLE_H